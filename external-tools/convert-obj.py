@@ -94,6 +94,84 @@ def triangle_aabb_intersect(v0: List[float], v1: List[float], v2: List[float],
 
     return True
 
+# Default palette of firmware/palette.c, in RGB565
+SCENE_PALETTE = [0x0000, 0x7A84, 0x05E0, 0x0017]
+
+def write_scene(voxel_data: bytearray, WN: int, output_path: str, palette: List[int] = SCENE_PALETTE) -> None:
+    """Write voxel data as a binary scene (.vxs), as read by firmware/scene.c.
+
+    Voxels are stored as runs along +x, sorted by z, then y, then x.
+    """
+    runs = []
+    voxel_count = 0
+    for z in range(WN):
+        for y in range(WN):
+            x = 0
+            while x < WN:
+                # y and z are swapped, as in the .h output
+                value = voxel_data[y * WN * WN + z * WN + x]
+                if not value:
+                    x += 1
+                    continue
+                length = 1
+                while (x + length < WN and length < 255
+                       and voxel_data[y * WN * WN + z * WN + x + length] == value):
+                    length += 1
+                runs.append(struct.pack('<hhhBB', x, y, z, value, length))
+                voxel_count += length
+                x += length
+
+    with open(output_path, 'wb') as f:
+        f.write(struct.pack('<4sHHII', b'VXS1', 1, len(palette), voxel_count, len(runs)))
+        f.write(struct.pack(f'<{len(palette)}H', *palette))
+        f.write(bytes(-len(palette) * 2 % 4))
+        f.writelines(runs)
+
+WORLD_REGION_SHIFT = 6
+
+def write_world(voxel_data: bytearray, WN: int, output_path: str, palette: List[int] = SCENE_PALETTE) -> None:
+    """Write voxel data as a streamed world (.vxw), as read by firmware/world_stream.c.
+
+    Voxels are grouped into 64x64x64 regions, each stored as runs along +x
+    that never leave the region, behind an index sorted by z, then y, then x.
+    """
+    size = 1 << WORLD_REGION_SHIFT
+    regions = {}
+    for z in range(WN):
+        for y in range(WN):
+            x = 0
+            while x < WN:
+                # y and z are swapped, as in the .h output
+                value = voxel_data[y * WN * WN + z * WN + x]
+                if not value:
+                    x += 1
+                    continue
+                length = 1
+                while (x + length < WN and (x + length) % size != 0
+                       and voxel_data[y * WN * WN + z * WN + x + length] == value):
+                    length += 1
+                key = (z >> WORLD_REGION_SHIFT, y >> WORLD_REGION_SHIFT, x >> WORLD_REGION_SHIFT)
+                cell = ((z % size) << (2 * WORLD_REGION_SHIFT)) | ((y % size) << WORLD_REGION_SHIFT) | (x % size)
+                regions.setdefault(key, []).append((cell << 14) | (value << 6) | (length - 1))
+                x += length
+
+    palette_bytes = len(palette) * 2 + (-len(palette) * 2 % 4)
+    offset = 12 + palette_bytes + 24 * len(regions)
+    index = []
+    for (rz, ry, rx), runs in sorted(regions.items()):
+        runs.sort()
+        voxel_count = sum((run & 0x3F) + 1 for run in runs)
+        index.append(struct.pack('<iiiIII', rx, ry, rz, offset, len(runs), voxel_count))
+        offset += 4 * len(runs)
+
+    with open(output_path, 'wb') as f:
+        f.write(struct.pack('<4sHHI', b'VXW1', 1, len(palette), len(regions)))
+        f.write(struct.pack(f'<{len(palette)}H', *palette))
+        f.write(bytes(-len(palette) * 2 % 4))
+        f.writelines(index)
+        for key in sorted(regions):
+            f.write(struct.pack(f'<{len(regions[key])}I', *regions[key]))
+
 def convert_obj_to_voxel(N: int, WN: int, obj_path: str, ox: int, oy: int, oz: int, output_path: str = None) -> bytearray:
     """Convert OBJ file to voxel data.
 
@@ -173,14 +251,15 @@ def convert_obj_to_voxel(N: int, WN: int, obj_path: str, ox: int, oy: int, oz: i
     # Write to file if output path provided
     if output_path:
         if output_path.endswith(".h"):
+            name = output_path[:-2]
             with open(output_path, 'w') as f:
                 f.write(f'''\
-#ifndef {output_path[:-2].upper()}_H
-#define {output_path[:-2].upper()}_H
+#ifndef {name.upper()}_H
+#define {name.upper()}_H
 
 #include "firmware/firmware.h"
 
-void load_{output_path[:-2]}() {{
+static const struct gpu_voxel {name}_voxels[] = {{
 ''')
                 for x in range(WN):
                     for y in range(WN):
@@ -188,10 +267,20 @@ void load_{output_path[:-2]}() {{
                             if voxel_data[z * WN * WN + y * WN + x]:
                                 # y and z are swapped
                                 f.write(f'''\
-    set_voxel((v_pos){{ .x = {x}, .y = {z}, .z = {y}}}, 1);
+    {{ .x = {x}, .y = {z}, .z = {y}, .voxel_id = 1 }},
 ''')
-                f.write('}')
-                f.write("\n\n#endif")
+                f.write(f'''\
+}};
+
+void load_{name}() {{
+    load_voxels({name}_voxels, sizeof({name}_voxels) / sizeof({name}_voxels[0]));
+}}
+
+#endif''')
+        elif output_path.endswith(".vxs"):
+            write_scene(voxel_data, WN, output_path)
+        elif output_path.endswith(".vxw"):
+            write_world(voxel_data, WN, output_path)
         else:
             with open(output_path, 'wb') as f:
                 f.write(voxel_data)
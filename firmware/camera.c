@@ -1,11 +1,23 @@
 #include "hardware/hardware.h"
 #include "firmware/firmware.h"
+#include "firmware/world.h"
+#include "firmware/world_stream.h"
 #include "software/vector_math.h"
 
 static float clip_plane_x, clip_plane_y;
 static float fov_degrees, focal_length;
 static float tanf_angle;
 
+cam_pos camera_position;
+
+int32_t to_camera_fixed(float a) {
+    return (int32_t)(a * (1 << FRACT_BITS));
+}
+
+float from_camera_fixed(int32_t a) {
+    return (float)a / (1 << FRACT_BITS);
+}
+
 void set_camera_settings(float _fov_degrees, float _focal_length) {
     /* reduce need to invoke sinf/cosf */
     if (_fov_degrees != fov_degrees) {
@@ -22,10 +34,19 @@ void set_camera_settings(float _fov_degrees, float _focal_length) {
 
 // TODO: Split set_camera component-wise for small optimization, minimizing calls
 void set_camera(struct Camera* cam) {
+    /* stream first, so a rebase already sees the regions just read;
+       the GPU only sees the window around world_origin */
+    world_stream_update(cam->pos.x, cam->pos.y, cam->pos.z);
+    world_follow_camera(cam->pos.x, cam->pos.y, cam->pos.z);
+    camera_position = (cam_pos){
+        cam->pos.x - world_origin.x,
+        cam->pos.y - world_origin.y,
+        cam->pos.z - world_origin.z
+    };
     GPU->camera.pos = (struct _vec3){
-        convert_float_to_fixed(cam->pos.x),
-        convert_float_to_fixed(cam->pos.y),
-        convert_float_to_fixed(cam->pos.z)
+        to_camera_fixed(camera_position.x),
+        to_camera_fixed(camera_position.y),
+        to_camera_fixed(camera_position.z)
     };
 
     /* right unit vector on the clipping plane */
@@ -51,30 +72,34 @@ void set_camera(struct Camera* cam) {
 
     /* top left */
     GPU->camera.look[0] = (struct _vec3){
-        convert_float_to_fixed(look_x_minus_right_x + up_x),
-        convert_float_to_fixed(look_y_minus_right_y + up_y),
-        convert_float_to_fixed(look_z_minus_right_z + up_z)
+        to_camera_fixed(look_x_minus_right_x + up_x),
+        to_camera_fixed(look_y_minus_right_y + up_y),
+        to_camera_fixed(look_z_minus_right_z + up_z)
     };
 
     /* top right */
     GPU->camera.look[1] = (struct _vec3){
-        convert_float_to_fixed(look_x_plus_right_x + up_x),
-        convert_float_to_fixed(look_y_plus_right_y + up_y),
-        convert_float_to_fixed(look_z_plus_right_z + up_z)
+        to_camera_fixed(look_x_plus_right_x + up_x),
+        to_camera_fixed(look_y_plus_right_y + up_y),
+        to_camera_fixed(look_z_plus_right_z + up_z)
     };
 
     /* bottom left */
     GPU->camera.look[2] = (struct _vec3){
-        convert_float_to_fixed(look_x_minus_right_x - up_x),
-        convert_float_to_fixed(look_y_minus_right_y - up_y),
-        convert_float_to_fixed(look_z_minus_right_z - up_z)
+        to_camera_fixed(look_x_minus_right_x - up_x),
+        to_camera_fixed(look_y_minus_right_y - up_y),
+        to_camera_fixed(look_z_minus_right_z - up_z)
     };
 
     /* bottom right */
     GPU->camera.look[3] = (struct _vec3){
-        convert_float_to_fixed(look_x_plus_right_x - up_x),
-        convert_float_to_fixed(look_y_plus_right_y - up_y),
-        convert_float_to_fixed(look_z_plus_right_z - up_z)
+        to_camera_fixed(look_x_plus_right_x - up_x),
+        to_camera_fixed(look_y_plus_right_y - up_y),
+        to_camera_fixed(look_z_plus_right_z - up_z)
     };
 
 }
+
+float camera_pixel_size(float distance) {
+    return distance * 2.0f * tanf_angle / H_RESOLUTION;
+}
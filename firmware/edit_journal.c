@@ -0,0 +1,110 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "firmware/edit_journal.h"
+
+struct voxel_dirty_box voxel_dirty_box;
+unsigned int pending_edit_count;
+
+struct voxel_edit {
+    w_pos pos;
+    uint32_t order;     // place in the journal, so that later edits win
+    uint8_t palette;
+};
+
+static struct voxel_edit* journal;
+static unsigned int journal_capacity;
+static uint8_t dirty_valid;
+
+void queue_voxel_edit(w_pos pos, uint8_t palette) {
+    if (pending_edit_count == journal_capacity) {
+        journal_capacity = journal_capacity ? journal_capacity * 2 : 64;
+        journal = (struct voxel_edit*)realloc(journal, journal_capacity * sizeof(struct voxel_edit));
+        if (journal == NULL) {
+            printf("Failed to allocate memory for edit journal\n");
+            while (1);
+        }
+    }
+    journal[pending_edit_count] = (struct voxel_edit){pos, pending_edit_count, palette};
+    ++pending_edit_count;
+}
+
+static inline int same_pos(const struct voxel_edit* a, const struct voxel_edit* b) {
+    return a->pos.x == b->pos.x && a->pos.y == b->pos.y && a->pos.z == b->pos.z;
+}
+
+static int compare_edit(const void* a, const void* b) {
+    const struct voxel_edit* ea = (const struct voxel_edit*)a;
+    const struct voxel_edit* eb = (const struct voxel_edit*)b;
+    if (ea->pos.z != eb->pos.z) return ea->pos.z < eb->pos.z ? -1 : 1;
+    if (ea->pos.y != eb->pos.y) return ea->pos.y < eb->pos.y ? -1 : 1;
+    if (ea->pos.x != eb->pos.x) return ea->pos.x < eb->pos.x ? -1 : 1;
+    return (ea->order > eb->order) - (ea->order < eb->order);
+}
+
+static const int32_t half_side = SIDE_LEN / 2;
+
+// voxel space position an edit lands on, if it lands on the voxel space at all
+static int edit_local_pos(w_pos pos, int direct, v_pos* local) {
+    if (!direct) return world_window_pos(pos, local);
+    if (pos.x < -half_side || pos.x >= half_side || pos.y < -half_side || pos.y >= half_side
+        || pos.z < -half_side || pos.z >= half_side)
+        return 0;
+    *local = (v_pos){pos.x, pos.y, pos.z};
+    return 1;
+}
+
+static void grow_dirty_box(v_pos pos) {
+    if (pos.x < voxel_dirty_box.min.x) voxel_dirty_box.min.x = pos.x;
+    if (pos.y < voxel_dirty_box.min.y) voxel_dirty_box.min.y = pos.y;
+    if (pos.z < voxel_dirty_box.min.z) voxel_dirty_box.min.z = pos.z;
+    if (pos.x > voxel_dirty_box.max.x) voxel_dirty_box.max.x = pos.x;
+    if (pos.y > voxel_dirty_box.max.y) voxel_dirty_box.max.y = pos.y;
+    if (pos.z > voxel_dirty_box.max.z) voxel_dirty_box.max.z = pos.z;
+}
+
+unsigned int apply_voxel_edits(void) {
+    if (pending_edit_count == 0) return 0;
+    qsort(journal, pending_edit_count, sizeof(struct voxel_edit), compare_edit);
+
+    /* a scene loaded straight into the voxel space has no world behind it,
+       and going through the world would have the next rebase replace the scene */
+    int direct = !world_in_use();
+
+    /* keep only the last edit of each position, and only if it changes the voxel */
+    unsigned int count = 0, inserts = 0;
+    for (unsigned int i = 0; i < pending_edit_count; ++i) {
+        const struct voxel_edit* edit = &journal[i];
+        if (i + 1 < pending_edit_count && same_pos(edit, &journal[i + 1])) continue;
+        v_pos local;
+        int in_window = edit_local_pos(edit->pos, direct, &local);
+        if (direct && !in_window) continue;
+        if ((direct ? get_voxel(local) : world_get_voxel(edit->pos)) == edit->palette) continue;
+        if (edit->palette != 0 && in_window && get_voxel(local) == 0) ++inserts;
+        journal[count++] = *edit;
+    }
+    pending_edit_count = 0;
+    if (count == 0) return 0;
+
+    dirty_valid = 1;
+    voxel_dirty_box.min = (v_pos){INT16_MAX, INT16_MAX, INT16_MAX};
+    voxel_dirty_box.max = (v_pos){INT16_MIN, INT16_MIN, INT16_MIN};
+    voxel_dirty_box.from_revision = voxel_revision;
+
+    reserve_voxels(voxel_count + inserts);
+    for (unsigned int i = 0; i < count; ++i) {
+        v_pos local;
+        if (!edit_local_pos(journal[i].pos, direct, &local)) {
+            world_set_voxel(journal[i].pos, journal[i].palette);
+            continue;
+        }
+        grow_dirty_box(local);
+        if (direct) set_voxel(local, journal[i].palette);
+        else world_set_voxel(journal[i].pos, journal[i].palette);
+    }
+    voxel_dirty_box.to_revision = voxel_revision;
+    return count;
+}
+
+int voxel_edits_cover(unsigned int revision) {
+    return dirty_valid && voxel_dirty_box.from_revision == revision && voxel_dirty_box.to_revision == voxel_revision;
+}
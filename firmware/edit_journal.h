@@ -0,0 +1,60 @@
+#ifndef EDIT_JOURNAL_H
+#define EDIT_JOURNAL_H
+
+#include <stdint.h>
+#include "firmware/firmware.h"
+#include "firmware/world.h"
+
+/*
+ * edits made while a frame is being drawn are only journaled, and
+ * the whole journal is applied at the start of the next frame, so
+ * voxel_space never changes (or moves) under the renderer and bursts of
+ * edits reserve room once instead of growing one voxel at a time.
+ * while the world layer is not in use, edits go straight to the scene
+ * in the voxel space, whose positions are then world positions.
+ */
+
+/**
+ * voxel space positions changed by the last batch of edits.
+ * min is above max on some axis if the batch changed nothing in the window.
+ */
+struct voxel_dirty_box {
+    v_pos min, max;              // inclusive corners
+    unsigned int from_revision;  // voxel_revision before the batch
+    unsigned int to_revision;    // voxel_revision after the batch
+};
+
+extern struct voxel_dirty_box voxel_dirty_box;
+
+/**
+ * number of edits waiting for apply_voxel_edits.
+ */
+extern unsigned int pending_edit_count;
+
+/**
+ * journals setting the voxel at pos to palette, or removing it if palette is 0.
+ * of several edits to one position, the last one wins.
+ * @param pos world position of the voxel
+ * @param palette palette index to set the voxel to
+ */
+void queue_voxel_edit(w_pos pos, uint8_t palette);
+
+/**
+ * applies every journaled edit to the world, and so to the voxel space,
+ * or only to the voxel space while the world is not in use. its index
+ * and face masks follow, then the journal is emptied.
+ * edits that would not change anything are dropped.
+ * voxel_dirty_box is set to cover what the batch changed in the window,
+ * and the boxes, bricks and LOD regions are only rebuilt for the chunks it touched.
+ * @return number of voxels that changed
+ */
+unsigned int apply_voxel_edits(void);
+
+/**
+ * @param revision voxel_revision at which derived data was last rebuilt
+ * @return whether the last batch of edits is the only change to the voxel
+ * space since revision, so only the data inside voxel_dirty_box has to be rebuilt
+ */
+int voxel_edits_cover(unsigned int revision);
+
+#endif
@@ -1,7 +1,9 @@
 #ifndef FIRMWARE_H
 #define FIRMWARE_H
 
+#include <stddef.h>
 #include <stdint.h>
+#include "hardware/hardware.h"
 #include "software/controls.h"
 
 /* defs */
@@ -9,7 +11,7 @@
 // #define PALETTE_START 0xC2FFFF00 // enough for 128 colors (1B palette -> 2B color)
 // #define GRID_START 0xC3000000
 
-#define SIDE_LEN 1024
+#define SIDE_LEN 1024 // voxels per axis of the voxel space, see world.h for larger worlds
 #define ASPECT_RATIO (4.0f/3.0f)
 #define H_RESOLUTION 320
 #define V_RESOLUTION 240
@@ -40,6 +42,41 @@ extern unsigned int voxel_count;
 extern struct gpu_voxel* voxel_space;
 extern unsigned int voxel_space_size;
 
+/**
+ * faces of a voxel, in the order used for exposed-face masks.
+ * opposite faces differ only in the lowest bit.
+ */
+enum voxel_face {
+    FACE_FRONT,  // +z
+    FACE_BACK,   // -z
+    FACE_TOP,    // -y
+    FACE_BOTTOM, // +y
+    FACE_LEFT,   // -x
+    FACE_RIGHT,  // +x
+    NUM_FACES
+};
+#define OPPOSITE_FACE(face) ((face) ^ 1)
+
+/**
+ * exposed-face mask of each voxel, parallel to voxel_space.
+ * bit i is set if the neighbour across face i is empty,
+ * so a voxel with a zero mask is fully enclosed.
+ */
+extern uint8_t* voxel_faces;
+
+/**
+ * number of voxels whose exposed-face mask is zero. such voxels
+ * can never be the nearest hit of a ray from outside them,
+ * so they are left out of the boxes and bricks sent to the GPU.
+ */
+extern unsigned int enclosed_voxel_count;
+
+/**
+ * incremented on every change to the voxel space,
+ * so derived data can tell when it must be rebuilt.
+ */
+extern unsigned int voxel_revision;
+
 typedef struct v_pos {
     int16_t x;
     int16_t y;
@@ -47,12 +84,145 @@ typedef struct v_pos {
 } v_pos;
 
 /**
- * sets voxel at pos to the given palette index.
+ * step from a voxel to its neighbour across each face.
+ */
+extern const v_pos face_offset[NUM_FACES];
+
+/* the voxel space is split into chunks of 32x32x32 voxels, and data
+   derived from it is only rebuilt for the chunks that changed */
+#define CHUNK_SHIFT 5
+#define CHUNK_AXIS (SIDE_LEN >> CHUNK_SHIFT)
+#define NUM_CHUNKS (CHUNK_AXIS * CHUNK_AXIS * CHUNK_AXIS)
+
+/**
+ * @param pos position inside the voxel space
+ * @return index of the chunk holding pos
+ */
+unsigned int voxel_chunk(v_pos pos);
+
+/**
+ * sets voxel at pos to the given palette index,
+ * updating the exposed-face masks of it and its neighbours.
+ * an occupied position only has its palette replaced,
+ * and palette 0 removes the voxel. positions outside
+ * the voxel space are ignored.
  * @param pos position of the voxel to set
  * @param palette palette index to set the voxel to
  */
 void set_voxel(v_pos pos, uint8_t palette);
 
+/**
+ * removes the voxel at pos, if any. the last voxel of
+ * voxel_space is moved into its slot, so indices into
+ * voxel_space are not stable across removals.
+ * @param pos position of the voxel to remove
+ */
+void remove_voxel(v_pos pos);
+
+/**
+ * @param pos position of the voxel
+ * @return palette index of the voxel at pos, or 0 if it is empty or outside the voxel space
+ */
+uint8_t get_voxel(v_pos pos);
+
+/**
+ * grows voxel_space (and everything kept parallel to it)
+ * to hold at least count voxels, so that adding them
+ * does not reallocate along the way.
+ * @param count number of voxels to make room for
+ */
+void reserve_voxels(unsigned int count);
+
+/**
+ * adds a table of voxels in one go, as set_voxel would one at a time,
+ * reserving room for all of them up front. voxels with palette 0 are skipped.
+ * @param voxels voxels to add
+ * @param count number of voxels in the table
+ */
+void load_voxels(const struct gpu_voxel* voxels, size_t count);
+
+/**
+ * moves every voxel by offset, dropping the ones that land outside
+ * the box from min up to but not including max. voxels left on the
+ * sides of the box are exposed across them, their neighbours having
+ * gone, until voxels are added beyond them again. if offset and the
+ * box are whole chunks, boxes and bricks move along with the voxels
+ * and only the chunks on the sides of the box are merged again.
+ * @param offset amount to move every voxel by
+ * @param min lowest corner of the box voxels are kept in
+ * @param max corner of the box just past its highest voxel
+ */
+void shift_voxels(v_pos offset, v_pos min, v_pos max);
+
+/**
+ * axis-aligned box of voxels sharing one palette index,
+ * as drawn by the GPU when voxel_extent is set.
+ */
+struct voxel_box {
+    struct gpu_voxel min;           // min corner and palette index
+    struct gpu_box_extent extent;   // size minus one along each axis
+};
+
+extern unsigned int voxel_box_count;
+extern struct voxel_box* voxel_boxes;
+
+/**
+ * greedily merges runs of same-palette voxels into boxes,
+ * growing each box along x, then y, then z as far as it stays solid.
+ * boxes made only of enclosed voxels are dropped.
+ * only the boxes reaching into chunks that changed since the last
+ * merge are merged again, along with the voxels of those chunks.
+ * does nothing if the voxel space is unchanged since the last merge.
+ * @return number of boxes in voxel_boxes
+ */
+unsigned int merge_voxel_boxes(void);
+
+/**
+ * up to 4x4x4 voxels of one palette index, drawn by the GPU
+ * as a single brick. cell (x, y, z) is bit z * 16 + y * 4 + x of mask.
+ */
+struct brick_packet {
+    struct gpu_voxel origin;    // min corner, a multiple of 4, and palette index
+    uint64_t mask;
+};
+
+extern unsigned int brick_packet_count;
+extern struct brick_packet* brick_packets;
+
+#define BRICK_PACKET_VOXELS 64
+
+/**
+ * @param box merged voxel box
+ * @return whether the box is small enough to be drawn through bricks,
+ * that is, smaller than a whole brick
+ */
+int box_in_bricks(const struct voxel_box* box);
+
+/**
+ * one bit per chunk, set for the chunks whose bricks pack_voxel_bricks
+ * has packed again. whatever is derived from the bricks rebuilds
+ * those chunks in turn and clears their bits.
+ */
+extern uint8_t repacked_chunks[NUM_CHUNKS / 8];
+
+/**
+ * how far shift_voxels has moved the bricks since this was last cleared.
+ * whatever is derived from the bricks moves along by as much and clears it.
+ */
+extern v_pos brick_shift;
+
+/**
+ * merges voxel boxes, then packs the voxels of every box smaller
+ * than a brick into bricks, so that only large boxes are left
+ * to be drawn as boxes. enclosed voxels are left out of the bricks.
+ * bricks of the same 8x8x8 region are adjacent in brick_packets.
+ * only the chunks whose boxes were merged again are packed again:
+ * the bricks of the other chunks keep their order, ahead of the new ones.
+ * does nothing if the voxel space is unchanged since the last pack.
+ * @return number of bricks in brick_packets
+ */
+unsigned int pack_voxel_bricks(void);
+
 /**
  * initializes the voxel list, allocating memory for the first 256 voxels
  */
@@ -78,10 +248,40 @@ typedef struct cam_pos {
  */
 void set_camera_settings(float _fov_degrees, float _focal_length);
 
+/**
+ * camera position last written to HW by set_camera,
+ * relative to world_origin.
+ */
+extern cam_pos camera_position;
+
+/**
+ * converts to the fixed point of GPU->camera and GPU->pick_depth, which
+ * have FRACT_BITS fraction bits, so voxel positions shifted by FRACT_BITS
+ * compare against them. everything written to or read from them goes
+ * through this and from_camera_fixed.
+ * @param a value in voxel units
+ * @return a with FRACT_BITS fraction bits
+ */
+int32_t to_camera_fixed(float a);
+
+/**
+ * @param a value with FRACT_BITS fraction bits, as read from GPU->camera or GPU->pick_depth
+ * @return a in voxel units
+ */
+float from_camera_fixed(int32_t a);
+
+/**
+ * @param distance distance from the camera along its view direction
+ * @return width in voxel units that one pixel covers at that distance
+ */
+float camera_pixel_size(float distance);
+
 /**
 * sets camera position and orientation in the voxel space.
 * the position of the camera and the top left / top right
 * / bottom left positions are written to HW.
+* the camera is given in world coordinates, and the world window
+* is rebased first if the camera has strayed too far from it.
 * set_camera_settings must be called before this function.
 * @param cam The position of the camera.
 * @param lookAt The point the camera is looking at.
@@ -89,4 +289,44 @@ void set_camera_settings(float _fov_degrees, float _focal_length);
 */
 void set_camera(struct Camera* camera);
 
+/* picking */
+
+/**
+ * what the GPU drew at the pick pixel in the last frame.
+ */
+struct gpu_pick {
+    uint8_t hit;          // whether any voxel was drawn there
+    uint8_t palette;
+    int instance;         // index of the instance drawn there, or -1 for the world
+    v_pos voxel;          // voxel drawn there, in voxel space or the instance's model space
+    float t;              // distance along the pixel's ray, in units of its look direction
+    struct Vector point;  // where the ray hit, in voxel space
+};
+
+extern struct gpu_pick gpu_pick;
+
+/**
+ * has each render read back what the GPU drew at a pixel into gpu_pick,
+ * while that pixel's chunk is still in the shaders.
+ * @param col column of the pixel, or -1 to stop picking
+ * @param row row of the pixel
+ */
+void set_pick_pixel(int col, int row);
+
+/**
+ * depth and closest voxel of each pixel of the last frame, as the GPU wrote them
+ * next to the colors. rows are 512 pixels apart, as in the pixel buffer.
+ * depths have GPU_DEPTH_FRACT_BITS fraction bits, and voxel type 0 means nothing was drawn.
+ * only written while depth output is on.
+ */
+extern volatile int16_t* frame_depth;
+extern volatile struct gpu_voxel* frame_voxels;
+
+/**
+ * turns writing frame_depth and frame_voxels on or off, from the next frame on.
+ * each pixel then costs three more writes to SDRAM.
+ * @param enabled whether the GPU should write them
+ */
+void set_depth_output(int enabled);
+
 #endif
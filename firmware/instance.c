@@ -0,0 +1,304 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "firmware/instance.h"
+
+unsigned int voxel_model_count;
+struct voxel_model* voxel_models;
+unsigned int voxel_instance_count;
+struct voxel_instance* voxel_instances;
+unsigned int visible_instance_count;
+unsigned int* visible_instances;
+
+static unsigned int model_capacity;
+static unsigned int instance_capacity;
+static unsigned int visible_capacity;
+
+static void* grow(void* buffer, unsigned int* capacity, unsigned int count, size_t size, const char* what) {
+    if (count <= *capacity) return buffer;
+    *capacity = *capacity ? *capacity * 2 : 8;
+    if (*capacity < count) *capacity = count;
+    buffer = realloc(buffer, (size_t)*capacity * size);
+    if (buffer == NULL) {
+        printf("Failed to allocate memory for %s\n", what);
+        while (1);
+    }
+    return buffer;
+}
+
+/* brick (7 bits per axis), then palette, then cell in the brick */
+#define KEY_CELL_BITS 6
+#define KEY_BRICK(key) ((key) >> (KEY_CELL_BITS + VOXEL_BITS))
+
+static int compare_keys(const void* a, const void* b) {
+    uint32_t ka = *(const uint32_t*)a, kb = *(const uint32_t*)b;
+    return (ka > kb) - (ka < kb);
+}
+
+int create_model(const struct gpu_voxel* voxels, size_t count) {
+    int min_x = SIDE_LEN, min_y = SIDE_LEN, min_z = SIDE_LEN;
+    int max_x = -SIDE_LEN, max_y = -SIDE_LEN, max_z = -SIDE_LEN;
+    size_t solid = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (voxels[i].voxel_id == 0) continue;
+        if (voxels[i].x < min_x) min_x = voxels[i].x;
+        if (voxels[i].y < min_y) min_y = voxels[i].y;
+        if (voxels[i].z < min_z) min_z = voxels[i].z;
+        if (voxels[i].x > max_x) max_x = voxels[i].x;
+        if (voxels[i].y > max_y) max_y = voxels[i].y;
+        if (voxels[i].z > max_z) max_z = voxels[i].z;
+        ++solid;
+    }
+    // larger models could be closer to the camera than the far side of themselves
+    // across the wrap of the GPU's coordinates
+    if (solid == 0 || max_x - min_x >= SIDE_LEN / 2 || max_y - min_y >= SIDE_LEN / 2
+        || max_z - min_z >= SIDE_LEN / 2)
+        return -1;
+
+    uint32_t* keys = (uint32_t*)malloc(solid * sizeof(uint32_t));
+    if (keys == NULL) {
+        printf("Failed to allocate memory for model keys\n");
+        while (1);
+    }
+    size_t key_count = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (voxels[i].voxel_id == 0) continue;
+        uint32_t x = voxels[i].x - min_x, y = voxels[i].y - min_y, z = voxels[i].z - min_z;
+        uint32_t brick = ((z >> 2) << 14) | ((y >> 2) << 7) | (x >> 2);
+        uint32_t cell = ((z & 3) << 4) | ((y & 3) << 2) | (x & 3);
+        keys[key_count++] = (((brick << VOXEL_BITS) | voxels[i].voxel_id) << KEY_CELL_BITS) | cell;
+    }
+    qsort(keys, key_count, sizeof(uint32_t), compare_keys);
+
+    unsigned int brick_count = 0;
+    for (size_t i = 0; i < key_count; ++i)
+        if (i == 0 || ((keys[i] ^ keys[i - 1]) >> KEY_CELL_BITS) != 0) ++brick_count;
+    struct brick_packet* bricks = (struct brick_packet*)malloc(brick_count * sizeof(struct brick_packet));
+    if (bricks == NULL) {
+        printf("Failed to allocate memory for model bricks\n");
+        while (1);
+    }
+    brick_count = 0;
+    for (size_t i = 0; i < key_count; ++i) {
+        uint32_t brick = KEY_BRICK(keys[i]);
+        if (i == 0 || ((keys[i] ^ keys[i - 1]) >> KEY_CELL_BITS) != 0) {
+            bricks[brick_count++] = (struct brick_packet){
+                .origin = {
+                    .x = (brick & 0x7F) << 2,
+                    .y = ((brick >> 7) & 0x7F) << 2,
+                    .z = (brick >> 14) << 2,
+                    .voxel_id = (keys[i] >> KEY_CELL_BITS) & ((1 << VOXEL_BITS) - 1),
+                },
+                .mask = 0,
+            };
+        }
+        bricks[brick_count - 1].mask |= (uint64_t)1 << (keys[i] & ((1 << KEY_CELL_BITS) - 1));
+    }
+    free(keys);
+
+    voxel_models = (struct voxel_model*)grow(voxel_models, &model_capacity, voxel_model_count + 1,
+                                             sizeof(struct voxel_model), "models");
+    voxel_models[voxel_model_count] = (struct voxel_model){
+        .size_x = max_x - min_x + 1,
+        .size_y = max_y - min_y + 1,
+        .size_z = max_z - min_z + 1,
+        .brick_count = brick_count,
+        .bricks = bricks,
+    };
+    return voxel_model_count++;
+}
+
+// world = turn * world, for a quarter turn about axis
+static void turn(int m[3][3], int axis) {
+    int a = (axis + 1) % 3, b = (axis + 2) % 3;
+    for (int col = 0; col < 3; ++col) {
+        int ra = m[a][col], rb = m[b][col];
+        m[a][col] = -rb;
+        m[b][col] = ra;
+    }
+}
+
+int add_instance(unsigned int model, w_pos pos, unsigned int turns_x, unsigned int turns_y, unsigned int turns_z) {
+    if (model >= voxel_model_count) return -1;
+
+    int m[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    for (unsigned int i = 0; i < turns_x % 4; ++i) turn(m, 0);
+    for (unsigned int i = 0; i < turns_y % 4; ++i) turn(m, 1);
+    for (unsigned int i = 0; i < turns_z % 4; ++i) turn(m, 2);
+
+    voxel_instances = (struct voxel_instance*)grow(voxel_instances, &instance_capacity, voxel_instance_count + 1,
+                                                   sizeof(struct voxel_instance), "instances");
+    struct voxel_instance* instance = &voxel_instances[voxel_instance_count];
+    *instance = (struct voxel_instance){ .model = model, .pos = pos };
+    for (int row = 0; row < 3; ++row)
+        for (int col = 0; col < 3; ++col)
+            if (m[row][col] != 0) {
+                instance->rotation_axis[row] = col;
+                instance->rotation_sign[row] = m[row][col];
+            }
+    return voxel_instance_count++;
+}
+
+void remove_instance(unsigned int instance) {
+    if (instance >= voxel_instance_count) return;
+    voxel_instances[instance] = voxel_instances[--voxel_instance_count];
+}
+
+void clear_instances(void) {
+    for (unsigned int i = 0; i < voxel_model_count; ++i)
+        free(voxel_models[i].bricks);
+    voxel_model_count = 0;
+    voxel_instance_count = 0;
+    visible_instance_count = 0;
+}
+
+static float dot(const float a[3], const float b[3]) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static void cross(const float a[3], const float b[3], float out[3]) {
+    out[0] = a[1] * b[2] - a[2] * b[1];
+    out[1] = a[2] * b[0] - a[0] * b[2];
+    out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+// the camera registers hold COORD_BITS + FRACT_BITS signed bits
+#define CAMERA_LIMIT (1 << (COORD_BITS + FRACT_BITS - 1))
+
+static int rotation_key(const struct voxel_instance* instance) {
+    return (instance->rotation_axis[0] * 3 + instance->rotation_axis[1]) << 3
+        | (instance->rotation_sign[0] < 0) << 2 | (instance->rotation_sign[1] < 0) << 1
+        | (instance->rotation_sign[2] < 0);
+}
+
+static int compare_rotations(const void* a, const void* b) {
+    unsigned int ia = *(const unsigned int*)a, ib = *(const unsigned int*)b;
+    int ka = rotation_key(&voxel_instances[ia]), kb = rotation_key(&voxel_instances[ib]);
+    if (ka != kb) return ka - kb;
+    return (ia > ib) - (ia < ib);
+}
+
+/* the ray of pixel (col, row) is look[0] + u * (look[1] - look[0]) + v * (look[2] - look[0])
+   with u = col / (H_RESOLUTION - 1) and v = row / (V_RESOLUTION - 1),
+   so the pixels a box may cover are within the (u, v) of its corners */
+static void find_screen_rect(struct voxel_instance* instance, const float box[2][3],
+                             const float camera[3], const struct _vec3 look[4]) {
+    float a[3] = { from_camera_fixed(look[0].x), from_camera_fixed(look[0].y), from_camera_fixed(look[0].z) };
+    float b[3] = { from_camera_fixed(look[1].x) - a[0], from_camera_fixed(look[1].y) - a[1], from_camera_fixed(look[1].z) - a[2] };
+    float c[3] = { from_camera_fixed(look[2].x) - a[0], from_camera_fixed(look[2].y) - a[1], from_camera_fixed(look[2].z) - a[2] };
+    float n[3], cn[3], nb[3];
+    cross(b, c, n);
+    cross(c, n, cn);
+    cross(n, b, nb);
+    float an = dot(a, n), bcn = dot(b, cn), cnb = dot(c, nb);
+
+    float min_u = INFINITY, max_u = -INFINITY, min_v = INFINITY, max_v = -INFINITY;
+    int behind = 0;
+    for (int corner = 0; corner < 8; ++corner) {
+        float d[3] = {
+            box[corner & 1][0] - camera[0],
+            box[(corner >> 1) & 1][1] - camera[1],
+            box[corner >> 2][2] - camera[2],
+        };
+        // d = lambda * ray(u, v), and the ray always has a distance of an along n
+        float lambda = dot(d, n) / an;
+        if (!(lambda > 0.0f)) {
+            ++behind;
+            continue;
+        }
+        float x[3] = { d[0] / lambda - a[0], d[1] / lambda - a[1], d[2] / lambda - a[2] };
+        float u = dot(x, cn) / bcn, v = dot(x, nb) / cnb;
+        if (u < min_u) min_u = u;
+        if (u > max_u) max_u = u;
+        if (v < min_v) min_v = v;
+        if (v > max_v) max_v = v;
+    }
+
+    instance->visible = behind < 8;
+    if (behind > 0) {
+        // corners on both sides of the camera project outside any bounds
+        min_u = min_v = 0.0f;
+        max_u = max_v = 1.0f;
+    }
+    min_u = floorf(min_u * (H_RESOLUTION - 1));
+    max_u = ceilf(max_u * (H_RESOLUTION - 1));
+    min_v = floorf(min_v * (V_RESOLUTION - 1));
+    max_v = ceilf(max_v * (V_RESOLUTION - 1));
+    if (max_u < 0.0f || max_v < 0.0f || min_u > H_RESOLUTION - 1 || min_v > V_RESOLUTION - 1) {
+        instance->visible = 0;
+        return;
+    }
+    instance->min_col = min_u < 0.0f ? 0 : (uint16_t)min_u;
+    instance->max_col = max_u > H_RESOLUTION - 1 ? H_RESOLUTION - 1 : (uint16_t)max_u;
+    instance->min_row = min_v < 0.0f ? 0 : (uint16_t)min_v;
+    instance->max_row = max_v > V_RESOLUTION - 1 ? V_RESOLUTION - 1 : (uint16_t)max_v;
+}
+
+void update_instance_views(struct _vec3 pos, const struct _vec3 look[4]) {
+    const int32_t world_pos[3] = { pos.x, pos.y, pos.z };
+    const float camera[3] = { from_camera_fixed(pos.x), from_camera_fixed(pos.y), from_camera_fixed(pos.z) };
+    const int32_t origin[3] = { world_origin.x, world_origin.y, world_origin.z };
+
+    for (unsigned int i = 0; i < voxel_instance_count; ++i) {
+        struct voxel_instance* instance = &voxel_instances[i];
+        const struct voxel_model* model = &voxel_models[instance->model];
+        const int32_t size[3] = { model->size_x, model->size_y, model->size_z };
+        const int32_t min[3] = { instance->pos.x, instance->pos.y, instance->pos.z };
+
+        /* the rotated box, in the voxel space, and where the model's (0, 0, 0) lands in it */
+        float box[2][3];
+        int32_t translation[3];
+        instance->visible = 1;
+        for (int axis = 0; axis < 3; ++axis) {
+            int64_t lo = (int64_t)min[axis] - origin[axis];
+            int64_t extent = size[instance->rotation_axis[axis]];
+            // like world voxels, every voxel of a model must be in the window, or
+            // the GPU's distances from the camera to the far ones wrap around
+            if (lo < -WORLD_WINDOW_HALF || lo + extent > WORLD_WINDOW_HALF) instance->visible = 0;
+            box[0][axis] = (float)lo;
+            box[1][axis] = (float)(lo + extent);
+            translation[axis] = (int32_t)(instance->rotation_sign[axis] < 0 ? lo + extent : lo);
+        }
+        if (!instance->visible) continue;
+
+        int32_t model_pos[3], model_look[4][3];
+        for (int axis = 0; axis < 3; ++axis) {
+            int a = instance->rotation_axis[axis], sign = instance->rotation_sign[axis];
+            model_pos[a] = sign * (world_pos[axis] - to_camera_fixed(translation[axis]));
+            if (model_pos[a] < -CAMERA_LIMIT || model_pos[a] >= CAMERA_LIMIT) instance->visible = 0;
+            for (int corner = 0; corner < 4; ++corner) {
+                const int32_t l[3] = { look[corner].x, look[corner].y, look[corner].z };
+                model_look[corner][a] = sign * l[axis];
+            }
+        }
+        instance->camera_pos = (struct _vec3){ model_pos[0], model_pos[1], model_pos[2] };
+        for (int corner = 0; corner < 4; ++corner)
+            instance->camera_look[corner] = (struct _vec3){
+                model_look[corner][0], model_look[corner][1], model_look[corner][2]
+            };
+
+        if (!instance->visible) continue;
+
+        find_screen_rect(instance, box, camera, look);
+    }
+
+    /* instances turned the same way share their camera_look,
+       so drawing them together saves recomputing the rays */
+    visible_instances = (unsigned int*)grow(visible_instances, &visible_capacity, voxel_instance_count,
+                                            sizeof(unsigned int), "visible instances");
+    visible_instance_count = 0;
+    for (unsigned int i = 0; i < voxel_instance_count; ++i)
+        if (voxel_instances[i].visible) visible_instances[visible_instance_count++] = i;
+    qsort(visible_instances, visible_instance_count, sizeof(unsigned int), compare_rotations);
+}
+
+int instance_in_chunk(const struct voxel_instance* instance, unsigned int first_pixel, unsigned int pixel_count) {
+    if (!instance->visible) return 0;
+    unsigned int first_row = first_pixel / H_RESOLUTION, last_row = (first_pixel + pixel_count - 1) / H_RESOLUTION;
+    if (last_row < instance->min_row || first_row > instance->max_row) return 0;
+    // a chunk wrapping onto the next row is taken to cover every column
+    if (first_row != last_row) return 1;
+    unsigned int first_col = first_pixel % H_RESOLUTION, last_col = first_col + pixel_count - 1;
+    return last_col >= instance->min_col && first_col <= instance->max_col;
+}
@@ -0,0 +1,99 @@
+#ifndef INSTANCE_H
+#define INSTANCE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "hardware/hardware.h"
+#include "firmware/firmware.h"
+#include "firmware/world.h"
+
+/*
+ * a model is stored once, as bricks in its own space, and drawn once
+ * per instance by moving the camera into the model's space and
+ * recomputing the rays of the chunk. rotations are by quarter turns,
+ * which only swap and negate axes, so distances along the rays are
+ * the same in both spaces and instances depth test against the world.
+ */
+
+/**
+ * voxels of a model packed into bricks, its min corner moved to (0, 0, 0).
+ */
+struct voxel_model {
+    int16_t size_x, size_y, size_z;
+    unsigned int brick_count;
+    struct brick_packet* bricks;
+};
+
+/**
+ * one placed copy of a model. world axis i is axis
+ * rotation_axis[i] of the model, negated if rotation_sign[i] is negative.
+ */
+struct voxel_instance {
+    unsigned int model;
+    w_pos pos;                  // world position of the min corner of the rotated model
+    uint8_t rotation_axis[3];
+    int8_t rotation_sign[3];
+    /* filled in by update_instance_views */
+    uint8_t visible;
+    uint16_t min_row, max_row, min_col, max_col;   // pixels the model may cover
+    struct _vec3 camera_pos;                       // camera in model space, as in GPU->camera
+    struct _vec3 camera_look[4];
+};
+
+extern unsigned int voxel_model_count;
+extern struct voxel_model* voxel_models;
+extern unsigned int voxel_instance_count;
+extern struct voxel_instance* voxel_instances;
+/* indices of the visible instances, those turned the same way next to each other */
+extern unsigned int visible_instance_count;
+extern unsigned int* visible_instances;
+
+/**
+ * packs a table of voxels into a new model. voxels with palette 0 are skipped.
+ * @param voxels voxels of the model, at any position
+ * @param count number of voxels in the table
+ * @return index of the model, or -1 if it is empty or larger than SIDE_LEN / 2 along an axis
+ */
+int create_model(const struct gpu_voxel* voxels, size_t count);
+
+/**
+ * places a copy of a model, rotated by quarter turns about x, then y, then z.
+ * @param model index of the model
+ * @param pos world position of the min corner of the rotated model
+ * @param turns_x quarter turns about x
+ * @param turns_y quarter turns about y
+ * @param turns_z quarter turns about z
+ * @return index of the instance, or -1 if there is no such model
+ */
+int add_instance(unsigned int model, w_pos pos, unsigned int turns_x, unsigned int turns_y, unsigned int turns_z);
+
+/**
+ * drops an instance, moving the last instance into its entry.
+ * @param instance index of the instance
+ */
+void remove_instance(unsigned int instance);
+
+/**
+ * drops every instance and model.
+ */
+void clear_instances(void);
+
+/**
+ * works out, for every instance, the camera in the model's space
+ * and the pixels the model may cover, from the world camera, and lists
+ * the visible ones in visible_instances. instances wholly behind the
+ * camera, or not wholly in the window, are marked invisible.
+ * @param pos camera position, as written to GPU->camera.pos
+ * @param look camera look directions, as written to GPU->camera.look
+ */
+void update_instance_views(struct _vec3 pos, const struct _vec3 look[4]);
+
+/**
+ * @param instance instance after update_instance_views
+ * @param first_pixel index of the first pixel of the chunk
+ * @param pixel_count pixels in the chunk
+ * @return whether the model may cover any pixel of the chunk
+ */
+int instance_in_chunk(const struct voxel_instance* instance, unsigned int first_pixel, unsigned int pixel_count);
+
+#endif
@@ -0,0 +1,229 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "firmware/lod.h"
+
+unsigned int lod_region_count;
+struct lod_region* lod_regions;
+
+static unsigned int lod_capacity;
+static unsigned int lod_revision;
+static uint8_t lod_valid;
+
+#define PALETTES (1 << VOXEL_BITS)
+
+// most common palette, ties going to the lower index. bricks never
+// hold palette 0, so it only wins when there are no votes at all
+static uint8_t majority(const uint16_t votes[PALETTES]) {
+    uint8_t best = 0;
+    for (int p = 1; p < PALETTES; ++p)
+        if (votes[p] > votes[best]) best = p;
+    return best;
+}
+
+/* one 8x8 bit plane per slice of a region across each axis, bit (b << 3) | a
+   set where the slice is occupied at (a, b). at level L a slice is 2^L voxels
+   thick, so a set bit means the column through it has a voxel somewhere */
+struct region_slices {
+    uint64_t along_x[LOD_LEVELS][LOD_REGION_SIZE]; // a = y, b = z
+    uint64_t along_y[LOD_LEVELS][LOD_REGION_SIZE]; // a = x, b = z
+    uint64_t along_z[LOD_LEVELS][LOD_REGION_SIZE]; // a = x, b = y
+};
+
+// size x size square of bits at (a, b) of a bit plane
+static inline uint64_t plane_square(unsigned int a, unsigned int b, unsigned int size) {
+    uint64_t column = (0x0101010101010101ull >> ((LOD_REGION_SIZE - size) << 3)) << (b << 3);
+    return column * ((((uint64_t)1 << size) - 1) << a);
+}
+
+/* most voxels of the face of a level cell that are covered when looking along any one axis */
+static unsigned int silhouette(const struct region_slices* slices, unsigned int level,
+        unsigned int x, unsigned int y, unsigned int z) {
+    const unsigned int size = 1 << level;
+    unsigned int covered = __builtin_popcountll(slices->along_x[level][x] & plane_square(y << level, z << level, size));
+    unsigned int along_y = __builtin_popcountll(slices->along_y[level][y] & plane_square(x << level, z << level, size));
+    unsigned int along_z = __builtin_popcountll(slices->along_z[level][z] & plane_square(x << level, y << level, size));
+    if (along_y > covered) covered = along_y;
+    if (along_z > covered) covered = along_z;
+    return covered;
+}
+
+/* cells of level L sit at (x, y, z) << L in the region, and form one
+   brick per palette from the palettes they vote for. cells covering
+   less than half their face are left empty, so that scattered voxels
+   don't grow into solid blocks far away */
+static void emit_level(struct lod_region* region, unsigned int level,
+        const uint16_t (*votes)[PALETTES], const struct region_slices* slices) {
+    const int brick_mask = ~((4 << level) - 1);
+    const unsigned int side = LOD_REGION_SIZE >> level;
+    const unsigned int size = 1 << level;
+    struct gpu_voxel origin = {
+        .x = region->x & brick_mask,
+        .y = region->y & brick_mask,
+        .z = region->z & brick_mask,
+    };
+    unsigned int ox = (region->x - origin.x) >> level;
+    unsigned int oy = (region->y - origin.y) >> level;
+    unsigned int oz = (region->z - origin.z) >> level;
+
+    uint64_t masks[PALETTES] = {0};
+    for (unsigned int cell = 0; cell < side * side * side; ++cell) {
+        unsigned int x = cell % side, y = (cell / side) % side, z = cell / (side * side);
+        if (2 * silhouette(slices, level, x, y, z) < size * size)
+            continue;
+        masks[majority(votes[cell])] |= (uint64_t)1 << (((oz + z) << 4) | ((oy + y) << 2) | (ox + x));
+    }
+
+    region->coarse_count[level - 1] = 0;
+    for (int p = 1; p < PALETTES; ++p) {
+        if (masks[p] == 0) continue;
+        origin.voxel_id = p;
+        region->coarse[level - 1][region->coarse_count[level - 1]++] = (struct brick_packet){
+            .origin = origin,
+            .mask = masks[p],
+        };
+    }
+}
+
+static void downsample_region(struct lod_region* region) {
+    uint16_t votes1[64][PALETTES] = {{0}};
+    uint16_t votes2[8][PALETTES] = {{0}};
+    uint16_t votes3[1][PALETTES] = {{0}};
+    struct region_slices slices = {{{0}}};
+
+    for (unsigned int i = 0; i < region->brick_count; ++i) {
+        const struct brick_packet* brick = &brick_packets[region->first_brick + i];
+        unsigned int ox = brick->origin.x - region->x;
+        unsigned int oy = brick->origin.y - region->y;
+        unsigned int oz = brick->origin.z - region->z;
+        uint64_t bits = brick->mask;
+        while (bits != 0) {
+            unsigned int cell = __builtin_ctzll(bits);
+            bits &= bits - 1;
+            unsigned int x = ox + (cell & 3), y = oy + ((cell >> 2) & 3), z = oz + (cell >> 4);
+            ++votes1[((z >> 1) << 4) | ((y >> 1) << 2) | (x >> 1)][brick->origin.voxel_id];
+            slices.along_x[0][x] |= (uint64_t)1 << ((z << 3) | y);
+            slices.along_y[0][y] |= (uint64_t)1 << ((z << 3) | x);
+            slices.along_z[0][z] |= (uint64_t)1 << ((y << 3) | x);
+        }
+    }
+
+    /* votes are summed upwards rather than taken from the finer winners,
+       so each level is decided by the voxels themselves */
+    for (unsigned int cell = 0; cell < 64; ++cell) {
+        unsigned int x = cell & 3, y = (cell >> 2) & 3, z = cell >> 4;
+        unsigned int parent = ((z >> 1) << 2) | ((y >> 1) << 1) | (x >> 1);
+        for (int p = 0; p < PALETTES; ++p)
+            votes2[parent][p] += votes1[cell][p];
+    }
+    for (unsigned int cell = 0; cell < 8; ++cell)
+        for (int p = 0; p < PALETTES; ++p)
+            votes3[0][p] += votes2[cell][p];
+    for (unsigned int level = 1; level < LOD_LEVELS; ++level) {
+        for (unsigned int i = 0; i < LOD_REGION_SIZE >> level; ++i) {
+            slices.along_x[level][i] = slices.along_x[level - 1][2 * i] | slices.along_x[level - 1][2 * i + 1];
+            slices.along_y[level][i] = slices.along_y[level - 1][2 * i] | slices.along_y[level - 1][2 * i + 1];
+            slices.along_z[level][i] = slices.along_z[level - 1][2 * i] | slices.along_z[level - 1][2 * i + 1];
+        }
+    }
+
+    emit_level(region, 1, votes1, &slices);
+    emit_level(region, 2, votes2, &slices);
+    emit_level(region, 3, votes3, &slices);
+}
+
+static void shift_region(struct lod_region* region, v_pos offset) {
+    region->x += offset.x;
+    region->y += offset.y;
+    region->z += offset.z;
+    for (unsigned int level = 1; level < LOD_LEVELS; ++level)
+        for (unsigned int i = 0; i < region->coarse_count[level - 1]; ++i) {
+            struct gpu_voxel* origin = &region->coarse[level - 1][i].origin;
+            origin->x += offset.x;
+            origin->y += offset.y;
+            origin->z += offset.z;
+        }
+}
+
+unsigned int update_lod_regions(void) {
+    unsigned int brick_count = pack_voxel_bricks();
+    if (lod_valid && lod_revision == voxel_revision)
+        return lod_region_count;
+    lod_valid = 1;
+    lod_revision = voxel_revision;
+
+    /* there are never more regions than bricks */
+    if (brick_count > lod_capacity) {
+        lod_capacity = brick_count;
+        lod_regions = (struct lod_region*)realloc(lod_regions, lod_capacity * sizeof(struct lod_region));
+        if (lod_regions == NULL) {
+            printf("Failed to allocate memory for LOD regions\n");
+            while (1);
+        }
+    }
+
+    /* regions of chunks that were not packed again keep their levels, moved
+       along with their bricks, which are still the first ones, in the same order */
+    const int half = SIDE_LEN / 2;
+    unsigned int kept = 0, first_brick = 0;
+    for (unsigned int i = 0; i < lod_region_count; ++i) {
+        struct lod_region* region = &lod_regions[i];
+        if (brick_shift.x | brick_shift.y | brick_shift.z)
+            shift_region(region, brick_shift);
+        if (region->x < -half || region->x >= half || region->y < -half || region->y >= half
+            || region->z < -half || region->z >= half)
+            continue;
+        unsigned int chunk = voxel_chunk((v_pos){region->x, region->y, region->z});
+        if (repacked_chunks[chunk >> 3] & (1 << (chunk & 7))) continue;
+        if (kept != i) lod_regions[kept] = lod_regions[i];
+        lod_regions[kept].first_brick = first_brick;
+        first_brick += lod_regions[kept++].brick_count;
+    }
+    memset(repacked_chunks, 0, sizeof(repacked_chunks));
+    brick_shift = (v_pos){0, 0, 0};
+
+    const int region_mask = ~(LOD_REGION_SIZE - 1);
+    lod_region_count = kept;
+    for (unsigned int i = first_brick; i < brick_count; ++i) {
+        const struct gpu_voxel* origin = &brick_packets[i].origin;
+        int x = origin->x & region_mask, y = origin->y & region_mask, z = origin->z & region_mask;
+        struct lod_region* region = lod_region_count > kept ? &lod_regions[lod_region_count - 1] : NULL;
+        if (region == NULL || region->x != x || region->y != y || region->z != z) {
+            region = &lod_regions[lod_region_count++];
+            memset(region, 0, sizeof(struct lod_region));
+            region->x = x;
+            region->y = y;
+            region->z = z;
+            region->first_brick = i;
+        }
+        ++region->brick_count;
+    }
+
+    for (unsigned int i = kept; i < lod_region_count; ++i)
+        downsample_region(&lod_regions[i]);
+    return lod_region_count;
+}
+
+// distance along one axis from p to the span [lo, lo + LOD_REGION_SIZE]
+static inline float axis_gap(float p, int lo) {
+    if (p < lo) return lo - p;
+    if (p > lo + LOD_REGION_SIZE) return p - (lo + LOD_REGION_SIZE);
+    return 0;
+}
+
+void select_lod_levels(void) {
+    for (unsigned int i = 0; i < lod_region_count; ++i) {
+        struct lod_region* region = &lod_regions[i];
+        float dx = axis_gap(camera_position.x, region->x);
+        float dy = axis_gap(camera_position.y, region->y);
+        float dz = axis_gap(camera_position.z, region->z);
+        float distance = sqrtf(dx * dx + dy * dy + dz * dz);
+
+        /* a 2^L voxel spans 2^L / pixel_size pixels */
+        float limit = camera_pixel_size(distance) * LOD_PIXELS;
+        unsigned int level = 0;
+        while (level + 1 < LOD_LEVELS && (float)(2 << level) <= limit) ++level;
+        region->level = level;
+    }
+}
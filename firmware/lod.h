@@ -0,0 +1,55 @@
+#ifndef LOD_H
+#define LOD_H
+
+#include <stdint.h>
+#include "hardware/hardware.h"
+#include "firmware/firmware.h"
+
+/* regions are 8x8x8 voxels, so level 3 covers a region with one voxel */
+#define LOD_REGION_SHIFT 3
+#define LOD_REGION_SIZE (1 << LOD_REGION_SHIFT)
+#define LOD_LEVELS (LOD_REGION_SHIFT + 1)
+_Static_assert(LOD_LEVELS <= (1 << BRICK_SCALE_BITS), "brick_scale must hold every LOD level");
+
+/* a coarse voxel may grow until it spans this many pixels on screen */
+#define LOD_PIXELS 2.0f
+
+/**
+ * the bricks of one 8x8x8 region and its downsampled levels.
+ * a voxel at level L is 2^L voxels wide. it is solid if, seen along
+ * some axis, at least half of its face is covered by the voxels in it,
+ * and its palette is the most common palette among those voxels.
+ * level L is drawn as up to one brick per palette with a brick_scale
+ * of L, the brick origin being the region's corner rounded down
+ * to a multiple of 4 << L.
+ */
+struct lod_region {
+    int16_t x, y, z;        // min corner, a multiple of LOD_REGION_SIZE
+    uint8_t brick_count;
+    uint8_t level;          // level chosen by select_lod_levels
+    uint32_t first_brick;   // index of the region's first brick in brick_packets
+    uint8_t coarse_count[LOD_LEVELS - 1];
+    struct brick_packet coarse[LOD_LEVELS - 1][(1 << VOXEL_BITS) - 1];
+};
+
+extern unsigned int lod_region_count;
+extern struct lod_region* lod_regions;
+
+/**
+ * packs voxel bricks, then groups them into regions and
+ * downsamples each region. only the voxels drawn through bricks
+ * are counted, as large boxes are always drawn at full detail.
+ * only the regions of chunks in repacked_chunks are downsampled again.
+ * does nothing if the voxel space is unchanged since the last update.
+ * @return number of regions in lod_regions
+ */
+unsigned int update_lod_regions(void);
+
+/**
+ * picks the level of every region from how large one pixel is at
+ * the region's nearest point to camera_position, choosing the coarsest
+ * level whose voxels stay within LOD_PIXELS pixels.
+ */
+void select_lod_levels(void);
+
+#endif
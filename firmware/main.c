@@ -1,10 +1,17 @@
 #include <stdlib.h>
+#include <string.h>
 #include "hardware/hardware.h"
 #include "firmware/firmware.h"
 #include "firmware/timing.h"
 #include "firmware/palette.h"
+#include "firmware/lod.h"
+#include "firmware/instance.h"
+#include "firmware/edit_journal.h"
 
 #define NUM_SHADERS 6
+// past both pixel buffers' worth of SDRAM
+#define DEPTH_BUFFER_OFFSET 0x00100000
+#define VOXEL_BUFFER_OFFSET 0x00200000
 
 unsigned char* pixel_buffer;
 unsigned char* char_buffer;
@@ -24,7 +31,123 @@ void wait_for_vsync() {
 
 }
 
+// lone voxels go out two to a word as offsets from a 16x16x16 brick,
+// so one voxel is held back until its partner arrives
+static struct gpu_voxel packet_origin;
+static int packet_origin_set;
+static struct gpu_voxel_packet held_packet;
+
+static void flush_packets(void) {
+    if (held_packet.voxel_id == 0) return;
+    GPU->rasterize_packets = (struct gpu_packet_pair){ .first = held_packet };
+    held_packet.voxel_id = 0;
+    while (GPU->render_status);
+}
+
+// drawn with the current voxel_extent, like rasterize_voxel
+static void draw_packed_voxel(struct gpu_voxel voxel) {
+    struct gpu_voxel origin = { .x = voxel.x & ~15, .y = voxel.y & ~15, .z = voxel.z & ~15 };
+    if (!packet_origin_set || origin.x != packet_origin.x
+        || origin.y != packet_origin.y || origin.z != packet_origin.z) {
+        flush_packets();
+        GPU->packet_origin = origin;
+        packet_origin = origin;
+        packet_origin_set = 1;
+    }
+    struct gpu_voxel_packet packet = {
+        .voxel_id = voxel.voxel_id, .x = voxel.x & 15, .y = voxel.y & 15, .z = voxel.z & 15
+    };
+    if (held_packet.voxel_id == 0) {
+        held_packet = packet;
+        return;
+    }
+    GPU->rasterize_packets = (struct gpu_packet_pair){ .first = held_packet, .second = packet };
+    held_packet.voxel_id = 0;
+    while (GPU->render_status);
+}
+
+// voxel_extent must already be set to cells of 2^scale voxels
+static void draw_brick(const struct brick_packet* brick, unsigned int scale) {
+    if ((brick->mask & (brick->mask - 1)) == 0) {
+        // a lone cell is cheaper to send as a voxel of its own
+        int cell = __builtin_ctzll(brick->mask);
+        struct gpu_voxel voxel = brick->origin;
+        voxel.x += (cell & 3) << scale;
+        voxel.y += ((cell >> 2) & 3) << scale;
+        voxel.z += (cell >> 4) << scale;
+        draw_packed_voxel(voxel);
+        return;
+    }
+    GPU->brick_mask[0] = (uint32_t)brick->mask;
+    GPU->brick_mask[1] = (uint32_t)(brick->mask >> 32);
+    GPU->rasterize_brick = brick->origin;
+    while (GPU->render_status);
+}
+
+struct gpu_pick gpu_pick;
+static int pick_col = -1, pick_row;
+
+void set_pick_pixel(int col, int row) {
+    pick_col = col;
+    pick_row = row;
+}
+
+// the GPU only knows the closest voxel drawn so far, so a nearer answer
+// after an instance's pass means that instance covers the pixel
+static void read_pick(int instance) {
+    struct gpu_voxel voxel = GPU->pick_voxel;
+    if (voxel.voxel_id == 0) return;
+    float t = from_camera_fixed(GPU->pick_depth);
+    if (gpu_pick.hit && t >= gpu_pick.t) return;
+    gpu_pick.hit = 1;
+    gpu_pick.palette = voxel.voxel_id;
+    gpu_pick.instance = instance;
+    gpu_pick.voxel = (v_pos){voxel.x, voxel.y, voxel.z};
+    gpu_pick.t = t;
+}
+
+// the GPU's ray through a pixel, interpolated between the corner rays like lerp2.sv does
+static struct Vector pixel_ray(const struct _vec3 look[4], int col, int row) {
+    float u = (float)col / (H_RESOLUTION - 1), v = (float)row / (V_RESOLUTION - 1);
+    struct Vector corner[4];
+    for (int i = 0; i < 4; ++i)
+        corner[i] = (struct Vector){
+            from_camera_fixed(look[i].x), from_camera_fixed(look[i].y), from_camera_fixed(look[i].z)
+        };
+    struct Vector top = {
+        corner[0].x + (corner[1].x - corner[0].x) * u,
+        corner[0].y + (corner[1].y - corner[0].y) * u,
+        corner[0].z + (corner[1].z - corner[0].z) * u
+    };
+    struct Vector bottom = {
+        corner[2].x + (corner[3].x - corner[2].x) * u,
+        corner[2].y + (corner[3].y - corner[2].y) * u,
+        corner[2].z + (corner[3].z - corner[2].z) * u
+    };
+    return (struct Vector){
+        top.x + (bottom.x - top.x) * v,
+        top.y + (bottom.y - top.y) * v,
+        top.z + (bottom.z - top.z) * v
+    };
+}
+
+volatile int16_t* frame_depth;
+volatile struct gpu_voxel* frame_voxels;
+
+void set_depth_output(int enabled) {
+    GPU->depth_buffer = enabled ? (int16_t*)frame_depth : NULL;
+    GPU->voxel_buffer = enabled ? (struct gpu_voxel*)frame_voxels : NULL;
+}
+
+static void write_camera_look(const struct _vec3 look[4]) {
+    for (int corner = 0; corner < 4; ++corner)
+        GPU->camera.look[corner] = look[corner];
+}
+
 void render() {
+    // Edits made since the last frame land all at once, before anything is derived from the voxels
+    apply_voxel_edits();
+
     // Before render, update GPU camera settings
     update_camera();
 
@@ -34,15 +157,101 @@ void render() {
     int col = 0;
     unsigned char *pixel_ptr = pixel_buffer;
 
+    // Solid same-palette regions of at least a brick's volume are drawn
+    // as one box each, and everything else is packed into 4x4x4 bricks.
+    // Far regions swap their bricks for ones with coarser cells
+    unsigned int region_count = update_lod_regions();
+    select_lod_levels();
+    packet_origin_set = 0;
+
+    struct _vec3 camera_pos = GPU->camera.pos;
+    struct _vec3 camera_look[4];
+    for (int corner = 0; corner < 4; ++corner)
+        camera_look[corner] = GPU->camera.look[corner];
+    update_instance_views(camera_pos, camera_look);
+
+    gpu_pick.hit = 0;
+    int pick_index = pick_col < 0 ? -1 : pick_row * H_RESOLUTION + pick_col;
+    if (pick_index >= 0) GPU->pick_pixel = (pick_row << 10) | (pick_col << 1);
+
     for (int i = 0; i < H_RESOLUTION * V_RESOLUTION; i += NUM_SHADERS) {
+        int pick_chunk = pick_index >= i && pick_index < i + NUM_SHADERS;
         GPU->start_pixel = i;
         while (GPU->render_status);
 
-        for (int voxel_id = 0; voxel_id < voxel_count; ++voxel_id) {
-            GPU->rasterize_voxel = voxel_space[voxel_id];
+        // voxel_extent is sticky, so only rewrite it when the size changes
+        struct gpu_box_extent extent = {0};
+        GPU->voxel_extent = extent;
+        for (unsigned int box_id = 0; box_id < voxel_box_count; ++box_id) {
+            const struct voxel_box* box = &voxel_boxes[box_id];
+            if (box_in_bricks(box)) continue;
+            if (box->extent.x != extent.x || box->extent.y != extent.y || box->extent.z != extent.z) {
+                extent = box->extent;
+                GPU->voxel_extent = extent;
+            }
+            GPU->rasterize_voxel = box->min;
             while (GPU->render_status);
         }
 
+        unsigned int level = 0;
+        GPU->voxel_extent = (struct gpu_box_extent){0};
+        for (unsigned int region_id = 0; region_id < region_count; ++region_id) {
+            const struct lod_region* region = &lod_regions[region_id];
+            if (level != region->level) {
+                // held voxels must be drawn at the size they were packed for
+                flush_packets();
+                // cells of level L are boxes 2^L voxels wide
+                level = region->level;
+                unsigned int size = (1 << level) - 1;
+                GPU->voxel_extent = (struct gpu_box_extent){
+                    .brick_scale = level, .x = size, .y = size, .z = size
+                };
+            }
+            if (level == 0) {
+                for (unsigned int brick_id = 0; brick_id < region->brick_count; ++brick_id)
+                    draw_brick(&brick_packets[region->first_brick + brick_id], 0);
+            } else {
+                for (unsigned int brick_id = 0; brick_id < region->coarse_count[level - 1]; ++brick_id)
+                    draw_brick(&region->coarse[level - 1][brick_id], level);
+            }
+        }
+        flush_packets();
+        GPU->voxel_extent = (struct gpu_box_extent){0};
+        if (pick_chunk) read_pick(-1);
+
+        // each instance is drawn with the camera moved into its model's space,
+        // the world camera going back in before the next chunk's rays. the shaders
+        // read the position as they draw, but only take new look directions on a
+        // raycast, which instances turned like the last one drawn (or like the
+        // world, if unturned) can skip
+        const struct _vec3* chunk_look = camera_look;
+        int camera_moved = 0;
+        for (unsigned int visible_id = 0; visible_id < visible_instance_count; ++visible_id) {
+            unsigned int instance_id = visible_instances[visible_id];
+            const struct voxel_instance* instance = &voxel_instances[instance_id];
+            if (!instance_in_chunk(instance, i, NUM_SHADERS)) continue;
+            flush_packets();
+            GPU->camera.pos = instance->camera_pos;
+            camera_moved = 1;
+            if (memcmp(chunk_look, instance->camera_look, sizeof(camera_look)) != 0) {
+                chunk_look = instance->camera_look;
+                write_camera_look(chunk_look);
+                GPU->raycast = 1;
+                while (GPU->render_status);
+            }
+
+            const struct voxel_model* model = &voxel_models[instance->model];
+            for (unsigned int brick_id = 0; brick_id < model->brick_count; ++brick_id)
+                draw_brick(&model->bricks[brick_id], 0);
+            if (pick_chunk) {
+                flush_packets();
+                read_pick(instance_id);
+            }
+        }
+        flush_packets();
+        if (camera_moved) GPU->camera.pos = camera_pos;
+        if (chunk_look != camera_look) write_camera_look(camera_look);
+
         for (int palette_id = 1; palette_id < palette_size; ++palette_id) {
             GPU->shade_entry = (struct gpu_palette_entry){
                 .voxel_id = palette_id, .color = palette_data[palette_id]
@@ -68,6 +277,16 @@ void render() {
     float end = fw_time + (200E6f - cur_time()) / 200E6f;
     gpu_latency = end - start;
 
+    if (gpu_pick.hit) {
+        // distances along a ray are the same in model space, so the world ray finds instance hits too
+        struct Vector ray = pixel_ray(camera_look, pick_col, pick_row);
+        gpu_pick.point = (struct Vector){
+            camera_position.x + ray.x * gpu_pick.t,
+            camera_position.y + ray.y * gpu_pick.t,
+            camera_position.z + ray.z * gpu_pick.t
+        };
+    }
+
     /* GPU interrupt handled, swap buffers */
     wait_for_vsync();
 }
@@ -98,5 +317,9 @@ void init_firmware() {
     pixel_buffer = PIXEL_BUF_CTRL->back_buffer;
     char_buffer = CHAR_BUF_CTRL->back_buffer;
 
+    frame_depth = (volatile int16_t*)(SDRAM_BASE + DEPTH_BUFFER_OFFSET);
+    frame_voxels = (volatile struct gpu_voxel*)(SDRAM_BASE + VOXEL_BUFFER_OFFSET);
+    set_depth_output(0);
+
     enable_timer();
 }
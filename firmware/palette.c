@@ -7,7 +7,7 @@
 //     0x07E0, // GREEN
 // };
 
-const uint16_t palette_data[] = {
+uint16_t palette_data[] = {
     0x0, // BLANK
     0x7A84, // BROWN
     0x05E0, // LIGHT GREEN
@@ -2,7 +2,9 @@
 #define PALETTE_H
 
 #include <stdint.h>
+#include "hardware/hardware.h"
 
-extern const uint16_t palette_data[4];
+// colors of each voxel type; scenes loaded at runtime may replace them
+extern uint16_t palette_data[1 << VOXEL_BITS];
 
 #endif // PALETTE_H
@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "firmware/scene.h"
+#include "firmware/palette.h"
+
+#if defined(__unix__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+int load_scene(const void* data, size_t size) {
+    const struct scene_header* header = (const struct scene_header*)data;
+    if (size < sizeof(struct scene_header)
+        || memcmp(header->magic, SCENE_MAGIC, sizeof(header->magic)) != 0
+        || header->version != SCENE_VERSION) {
+        printf("Not a scene file\n");
+        return -1;
+    }
+
+    size_t palette_bytes = (header->palette_size * sizeof(uint16_t) + 3) & ~(size_t)3;
+    size_t runs_offset = sizeof(struct scene_header) + palette_bytes;
+    if (runs_offset > size || (size - runs_offset) / sizeof(struct scene_run) < header->run_count) {
+        printf("Scene file is truncated\n");
+        return -1;
+    }
+
+    /* runs are checked before anything is replaced, so a corrupt scene leaves the old one loaded */
+    const struct scene_run* runs = (const struct scene_run*)((const uint8_t*)data + runs_offset);
+    size_t total = 0;
+    for (uint32_t i = 0; i < header->run_count; ++i) {
+        if (runs[i].palette >= (1 << VOXEL_BITS)) {
+            printf("Scene file is corrupt\n");
+            return -1;
+        }
+        total += runs[i].length;
+    }
+
+    /* entries past what voxel_id can index are ignored */
+    const uint16_t* palette = (const uint16_t*)((const uint8_t*)data + sizeof(struct scene_header));
+    for (unsigned int i = 0; i < header->palette_size && i < (1 << VOXEL_BITS); ++i)
+        palette_data[i] = palette[i];
+
+    /* expand the runs into one table and add it in a single load_voxels,
+       dropping voxels outside the voxel space as set_voxel would */
+    struct gpu_voxel* voxels = (struct gpu_voxel*)malloc(total * sizeof(struct gpu_voxel));
+    if (voxels == NULL && total != 0) {
+        printf("Failed to allocate memory for scene\n");
+        while (1);
+    }
+    const int half = SIDE_LEN / 2;
+    size_t count = 0;
+    for (uint32_t i = 0; i < header->run_count; ++i) {
+        struct scene_run run = runs[i];
+        if (run.palette == 0 || run.y < -half || run.y >= half || run.z < -half || run.z >= half)
+            continue;
+        int start = run.x < -half ? -half : run.x;
+        int end = run.x + run.length > half ? half : run.x + run.length;
+        for (int x = start; x < end; ++x)
+            voxels[count++] = (struct gpu_voxel){.x = x, .y = run.y, .z = run.z, .voxel_id = run.palette};
+    }
+
+    clear_voxel_list();
+    init_voxel_list();
+    load_voxels(voxels, count);
+    free(voxels);
+    return 0;
+}
+
+#if defined(__unix__)
+int load_scene_file(const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Failed to open scene %s\n", path);
+        return -1;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        printf("Failed to read scene %s\n", path);
+        close(fd);
+        return -1;
+    }
+    void* data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        printf("Failed to map scene %s\n", path);
+        return -1;
+    }
+    int result = load_scene(data, info.st_size);
+    munmap(data, info.st_size);
+    return result;
+}
+#endif
@@ -0,0 +1,54 @@
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "hardware/hardware.h"
+#include "firmware/firmware.h"
+
+/*
+ * binary scene format (.vxs), little-endian:
+ *   struct scene_header
+ *   uint16_t palette[palette_size], padded to a multiple of 4 bytes
+ *   struct scene_run runs[run_count]
+ * runs go along +x and are sorted by z, then y, then x.
+ */
+#define SCENE_MAGIC "VXS1"
+#define SCENE_VERSION 1
+
+struct scene_header {
+    char magic[4];
+    uint16_t version;
+    uint16_t palette_size;  // entries, including the blank entry 0
+    uint32_t voxel_count;   // sum of all run lengths
+    uint32_t run_count;
+};
+
+/**
+ * length voxels of one palette index starting at (x, y, z)
+ */
+struct scene_run {
+    int16_t x, y, z;
+    uint8_t palette;
+    uint8_t length;
+};
+
+/**
+ * replaces the voxel space and palette with the scene in data,
+ * reserving room for all of its voxels up front.
+ * @param data scene file contents, 4-byte aligned
+ * @param size size of data in bytes
+ * @return 0 on success, -1 if data is not a valid scene
+ */
+int load_scene(const void* data, size_t size);
+
+#if defined(__unix__)
+/**
+ * maps the scene file at path into memory and loads it.
+ * @param path path of the .vxs file
+ * @return 0 on success, -1 if the file cannot be read or is not a valid scene
+ */
+int load_scene_file(const char* path);
+#endif
+
+#endif
@@ -1,5 +1,7 @@
 #include "hardware/hardware.h"
 #include "firmware/firmware.h"
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #define abs(x) ((x >= 0) ? (x) : (-x))
@@ -7,28 +9,649 @@
 unsigned int voxel_count;
 struct gpu_voxel* voxel_space;
 unsigned int voxel_space_size;
+uint8_t* voxel_faces;
+unsigned int voxel_revision;
+unsigned int enclosed_voxel_count;
+unsigned int voxel_box_count;
+struct voxel_box* voxel_boxes;
 
-void set_voxel(v_pos pos, uint8_t palette) {
-    if (voxel_count == voxel_space_size) {
+static unsigned int merged_revision;
+static unsigned int merge_capacity;
+static uint32_t* merge_order;   // voxel indices, sorted by position
+static uint8_t* merged;         // set once a voxel belongs to a box
+
+unsigned int brick_packet_count;
+struct brick_packet* brick_packets;
+
+static unsigned int packed_revision;
+static unsigned int pack_capacity;
+static uint32_t* pack_keys;     // brick, palette, then cell of each single voxel
+
+uint8_t repacked_chunks[NUM_CHUNKS / 8];
+v_pos brick_shift;
+
+/* chunks with a voxel added, removed, repainted or exposed differently since
+   the last merge, and chunks whose boxes were merged again since the last pack */
+static uint8_t changed_chunks[NUM_CHUNKS / 8];
+static uint8_t remerged_chunks[NUM_CHUNKS / 8];
+static uint8_t all_changed = 1;     // so much moved that no box is worth keeping
+
+const v_pos face_offset[NUM_FACES] = {
+    [FACE_FRONT] = {0, 0, 1},
+    [FACE_BACK] = {0, 0, -1},
+    [FACE_TOP] = {0, -1, 0},
+    [FACE_BOTTOM] = {0, 1, 0},
+    [FACE_LEFT] = {-1, 0, 0},
+    [FACE_RIGHT] = {1, 0, 0},
+};
+
+/* position -> voxel_space index, open addressing with linear probing.
+   kept at most half full, with capacity twice voxel_space_size */
+#define EMPTY_KEY 0xFFFFFFFF
+#define COORD_MASK ((1 << COORD_BITS) - 1)
+
+struct voxel_slot {
+    uint32_t key;   // packed 10-bit x, y, z
+    uint32_t index;
+};
+
+static struct voxel_slot* voxel_index;
+static unsigned int voxel_index_mask;
+
+/* added to positions before they are packed, so that shift_voxels can
+   move every voxel without rehashing it: a moved voxel keeps its key */
+static v_pos key_shift;
+
+static inline uint32_t pack_key(v_pos pos) {
+    return ((uint32_t)((pos.x + key_shift.x) & COORD_MASK) << (2 * COORD_BITS))
+        | ((uint32_t)((pos.y + key_shift.y) & COORD_MASK) << COORD_BITS)
+        | (uint32_t)((pos.z + key_shift.z) & COORD_MASK);
+}
+
+/* the low bits of the product only depend on the low bits of the key,
+   i.e. on z and part of y, so fold the high bits down before masking */
+static inline uint32_t home_slot(uint32_t key) {
+    uint32_t hash = key * 2654435761u;
+    return (hash ^ (hash >> 16)) & voxel_index_mask;
+}
+
+/* pack_key wraps every axis to COORD_BITS, so a position outside
+   [-SIDE_LEN / 2, SIDE_LEN / 2) would alias one on the other side */
+static inline int in_voxel_space(v_pos pos) {
+    const int half = SIDE_LEN / 2;
+    return pos.x >= -half && pos.x < half && pos.y >= -half && pos.y < half && pos.z >= -half && pos.z < half;
+}
+
+unsigned int voxel_chunk(v_pos pos) {
+    const int half = SIDE_LEN / 2;
+    return ((unsigned int)(pos.z + half) >> CHUNK_SHIFT) * CHUNK_AXIS * CHUNK_AXIS
+        + ((unsigned int)(pos.y + half) >> CHUNK_SHIFT) * CHUNK_AXIS
+        + ((unsigned int)(pos.x + half) >> CHUNK_SHIFT);
+}
+
+static inline int chunk_marked(const uint8_t* chunks, unsigned int chunk) {
+    return chunks[chunk >> 3] & (1 << (chunk & 7));
+}
+
+static inline void mark_changed(struct gpu_voxel voxel) {
+    unsigned int chunk = voxel_chunk((v_pos){voxel.x, voxel.y, voxel.z});
+    changed_chunks[chunk >> 3] |= 1 << (chunk & 7);
+}
+
+static void mark_all_changed(void) {
+    memset(changed_chunks, 0xFF, sizeof(changed_chunks));
+    all_changed = 1;
+}
+
+/* visits the chunks a box reaches into, marking each of them in chunks
+   if mark is set, or else stopping at the first one already marked */
+static int box_chunks(uint8_t* chunks, const struct voxel_box* box, int mark) {
+    const int half = SIDE_LEN / 2;
+    unsigned int x0 = (box->min.x + half) >> CHUNK_SHIFT, x1 = (box->min.x + box->extent.x + half) >> CHUNK_SHIFT;
+    unsigned int y0 = (box->min.y + half) >> CHUNK_SHIFT, y1 = (box->min.y + box->extent.y + half) >> CHUNK_SHIFT;
+    unsigned int z0 = (box->min.z + half) >> CHUNK_SHIFT, z1 = (box->min.z + box->extent.z + half) >> CHUNK_SHIFT;
+    for (unsigned int z = z0; z <= z1; ++z)
+        for (unsigned int y = y0; y <= y1; ++y)
+            for (unsigned int x = x0; x <= x1; ++x) {
+                unsigned int chunk = (z * CHUNK_AXIS + y) * CHUNK_AXIS + x;
+                if (mark) chunks[chunk >> 3] |= 1 << (chunk & 7);
+                else if (chunk_marked(chunks, chunk)) return 1;
+            }
+    return 0;
+}
+
+// slot holding key, or the empty slot where it would go
+static uint32_t find_slot(uint32_t key) {
+    uint32_t slot = home_slot(key);
+    while (voxel_index[slot].key != key && voxel_index[slot].key != EMPTY_KEY)
+        slot = (slot + 1) & voxel_index_mask;
+    return slot;
+}
+
+static void rebuild_index(void) {
+    free(voxel_index);
+    voxel_index_mask = 2 * voxel_space_size - 1;
+    voxel_index = (struct voxel_slot*)malloc((voxel_index_mask + 1) * sizeof(struct voxel_slot));
+    if (voxel_index == NULL) {
+        printf("Failed to allocate memory for voxel index\n");
+        while (1);
+    }
+    memset(voxel_index, 0xFF, (voxel_index_mask + 1) * sizeof(struct voxel_slot));
+    for (unsigned int i = 0; i < voxel_count; ++i) {
+        uint32_t key = pack_key((v_pos){voxel_space[i].x, voxel_space[i].y, voxel_space[i].z});
+        voxel_index[find_slot(key)] = (struct voxel_slot){key, i};
+    }
+}
+
+/* empties a slot, shifting later entries of the probe run back
+   so that no lookup stops early at the hole */
+static void erase_slot(uint32_t hole) {
+    uint32_t next = (hole + 1) & voxel_index_mask;
+    while (voxel_index[next].key != EMPTY_KEY) {
+        uint32_t home = home_slot(voxel_index[next].key);
+        if (((next - home) & voxel_index_mask) >= ((next - hole) & voxel_index_mask)) {
+            voxel_index[hole] = voxel_index[next];
+            hole = next;
+        }
+        next = (next + 1) & voxel_index_mask;
+    }
+    voxel_index[hole].key = EMPTY_KEY;
+}
+
+// index of the occupied voxel at pos, or -1 if there is none
+static int find_voxel(v_pos pos) {
+    if (voxel_index == NULL || !in_voxel_space(pos)) return -1;
+    uint32_t slot = find_slot(pack_key(pos));
+    return voxel_index[slot].key == EMPTY_KEY ? -1 : (int)voxel_index[slot].index;
+}
+
+// neighbour across face is now occupied, hiding that side of the voxel at index
+static void cover_face(int index, int face) {
+    if (voxel_faces[index] == 0) return;
+    voxel_faces[index] &= ~(1 << face);
+    if (voxel_faces[index] == 0) ++enclosed_voxel_count;
+    mark_changed(voxel_space[index]);
+}
+
+static void uncover_face(int index, int face) {
+    if (voxel_faces[index] == 0) --enclosed_voxel_count;
+    voxel_faces[index] |= 1 << face;
+    mark_changed(voxel_space[index]);
+}
+
+static v_pos neighbour_pos(v_pos pos, int face) {
+    return (v_pos){
+        pos.x + face_offset[face].x,
+        pos.y + face_offset[face].y,
+        pos.z + face_offset[face].z
+    };
+}
+
+/* adds voxel at the empty index slot its key probes to. a face is exposed only
+   if there is no neighbour across it, and voxel in turn covers the facing side
+   of each neighbour. there must be room for it in voxel_space */
+static void append_voxel(uint32_t slot, uint32_t key, struct gpu_voxel voxel) {
+    v_pos pos = {voxel.x, voxel.y, voxel.z};
+    uint8_t exposed = 0;
+    for (int face = 0; face < NUM_FACES; ++face) {
+        int neighbour = find_voxel(neighbour_pos(pos, face));
+        if (neighbour < 0)
+            exposed |= 1 << face;
+        else
+            cover_face(neighbour, OPPOSITE_FACE(face));
+    }
+    if (exposed == 0) ++enclosed_voxel_count;
+
+    voxel_index[slot] = (struct voxel_slot){key, voxel_count};
+    voxel_faces[voxel_count] = exposed;
+    voxel_space[voxel_count++] = voxel;
+    mark_changed(voxel);
+}
+
+void reserve_voxels(unsigned int count) {
+    if (count <= voxel_space_size) return;
+    if (voxel_space_size == 0) voxel_space_size = 256;
+    while (voxel_space_size < count)
         voxel_space_size *= 2;
-        voxel_space = (struct gpu_voxel*)realloc(voxel_space, voxel_space_size * sizeof(struct gpu_voxel));
-        if (voxel_space == NULL) {
-            printf("Failed to allocate memory for voxel space\n");
-            while (1);
+    voxel_space = (struct gpu_voxel*)realloc(voxel_space, voxel_space_size * sizeof(struct gpu_voxel));
+    voxel_faces = (uint8_t*)realloc(voxel_faces, voxel_space_size * sizeof(uint8_t));
+    if (voxel_space == NULL || voxel_faces == NULL) {
+        printf("Failed to allocate memory for voxel space\n");
+        while (1);
+    }
+    rebuild_index();
+}
+
+uint8_t get_voxel(v_pos pos) {
+    int index = find_voxel(pos);
+    return index < 0 ? 0 : voxel_space[index].voxel_id;
+}
+
+void set_voxel(v_pos pos, uint8_t palette) {
+    if (!in_voxel_space(pos)) return;
+    if (palette == 0) {
+        remove_voxel(pos);
+        return;
+    }
+
+    /* already occupied, so only its palette changes */
+    int existing = find_voxel(pos);
+    if (existing >= 0) {
+        if (voxel_space[existing].voxel_id != palette) {
+            voxel_space[existing].voxel_id = palette;
+            mark_changed(voxel_space[existing]);
+            ++voxel_revision;
         }
+        return;
     }
-    voxel_space[voxel_count++] = (struct gpu_voxel){
+
+    if (voxel_count == voxel_space_size)
+        reserve_voxels(voxel_space_size * 2);
+
+    ++voxel_revision;
+    uint32_t key = pack_key(pos);
+    append_voxel(find_slot(key), key, (struct gpu_voxel){
         .x = pos.x,
         .y = pos.y,
         .z = pos.z,
         .voxel_id = palette
+    });
+}
+
+void load_voxels(const struct gpu_voxel* voxels, size_t count) {
+    reserve_voxels(voxel_count + count);
+
+    /* one pass, as set_voxel would go, so that neighbour lookups run while
+       the index is still filling up. duplicates replace the earlier palette */
+    for (size_t i = 0; i < count; ++i) {
+        struct gpu_voxel voxel = voxels[i];
+        if (voxel.voxel_id == 0) continue;
+        uint32_t key = pack_key((v_pos){voxel.x, voxel.y, voxel.z});
+        uint32_t slot = find_slot(key);
+        if (voxel_index[slot].key != EMPTY_KEY) {
+            voxel_space[voxel_index[slot].index].voxel_id = voxel.voxel_id;
+            mark_changed(voxel);
+        } else
+            append_voxel(slot, key, voxel);
+    }
+    ++voxel_revision;
+}
+
+/* takes the voxel in slot out of the index and voxel_space, filling
+   its gap with the last voxel so the list stays dense */
+static void drop_voxel(uint32_t slot) {
+    unsigned int index = voxel_index[slot].index;
+    erase_slot(slot);
+    if (voxel_faces[index] == 0) --enclosed_voxel_count;
+    mark_changed(voxel_space[index]);
+
+    unsigned int last = --voxel_count;
+    if (index != last) {
+        voxel_space[index] = voxel_space[last];
+        voxel_faces[index] = voxel_faces[last];
+        uint32_t moved = pack_key((v_pos){voxel_space[index].x, voxel_space[index].y, voxel_space[index].z});
+        voxel_index[find_slot(moved)].index = index;
+    }
+}
+
+void remove_voxel(v_pos pos) {
+    if (voxel_index == NULL || !in_voxel_space(pos)) return;
+    uint32_t slot = find_slot(pack_key(pos));
+    if (voxel_index[slot].key == EMPTY_KEY) return;
+
+    /* neighbours now see empty space across their facing side */
+    for (int face = 0; face < NUM_FACES; ++face) {
+        int neighbour = find_voxel(neighbour_pos(pos, face));
+        if (neighbour >= 0)
+            uncover_face(neighbour, OPPOSITE_FACE(face));
+    }
+    drop_voxel(slot);
+    ++voxel_revision;
+}
+
+// moves the bits of chunks by offset, a multiple of the chunk size, dropping those that leave the voxel space
+static void shift_chunks(uint8_t* chunks, v_pos offset) {
+    static uint8_t moved[NUM_CHUNKS / 8];
+    memset(moved, 0, sizeof(moved));
+    int dx = offset.x >> CHUNK_SHIFT, dy = offset.y >> CHUNK_SHIFT, dz = offset.z >> CHUNK_SHIFT;
+    for (unsigned int chunk = 0; chunk < NUM_CHUNKS; ++chunk) {
+        if (!chunk_marked(chunks, chunk)) continue;
+        int x = chunk % CHUNK_AXIS + dx, y = chunk / CHUNK_AXIS % CHUNK_AXIS + dy, z = chunk / (CHUNK_AXIS * CHUNK_AXIS) + dz;
+        if (x < 0 || x >= CHUNK_AXIS || y < 0 || y >= CHUNK_AXIS || z < 0 || z >= CHUNK_AXIS) continue;
+        unsigned int to = (z * CHUNK_AXIS + y) * CHUNK_AXIS + x;
+        moved[to >> 3] |= 1 << (to & 7);
+    }
+    memcpy(chunks, moved, sizeof(moved));
+}
+
+/* moves boxes and bricks along with voxels shifted by whole chunks into
+   the chunk-aligned box from min to max, so that only the chunks on its
+   sides, whose voxels are now exposed across them, are merged again */
+static void shift_derived(v_pos offset, v_pos min, v_pos max) {
+    shift_chunks(changed_chunks, offset);
+    shift_chunks(remerged_chunks, offset);
+    shift_chunks(repacked_chunks, offset);
+
+    const int half = SIDE_LEN / 2;
+    for (int z = -half; z < half; z += 1 << CHUNK_SHIFT)
+        for (int y = -half; y < half; y += 1 << CHUNK_SHIFT)
+            for (int x = -half; x < half; x += 1 << CHUNK_SHIFT) {
+                unsigned int chunk = voxel_chunk((v_pos){x, y, z});
+                int inside = x >= min.x && x < max.x && y >= min.y && y < max.y && z >= min.z && z < max.z;
+                /* regions derived from bricks outside the box go, as the bricks have */
+                if (!inside) repacked_chunks[chunk >> 3] |= 1 << (chunk & 7);
+                else if (x == min.x || x + (1 << CHUNK_SHIFT) == max.x || y == min.y
+                    || y + (1 << CHUNK_SHIFT) == max.y || z == min.z || z + (1 << CHUNK_SHIFT) == max.z)
+                    changed_chunks[chunk >> 3] |= 1 << (chunk & 7);
+            }
+
+    /* a box that now reaches outside has lost voxels, and the rest of it is merged again */
+    unsigned int kept = 0;
+    for (unsigned int i = 0; i < voxel_box_count && !all_changed; ++i) {
+        struct voxel_box box = voxel_boxes[i];
+        int x0 = box.min.x + offset.x, y0 = box.min.y + offset.y, z0 = box.min.z + offset.z;
+        int x1 = x0 + box.extent.x, y1 = y0 + box.extent.y, z1 = z0 + box.extent.z;
+        if (x0 >= min.x && x1 < max.x && y0 >= min.y && y1 < max.y && z0 >= min.z && z1 < max.z) {
+            box.min.x = x0;
+            box.min.y = y0;
+            box.min.z = z0;
+            voxel_boxes[kept++] = box;
+        } else if (x1 >= min.x && x0 < max.x && y1 >= min.y && y0 < max.y && z1 >= min.z && z0 < max.z) {
+            if (x0 < min.x) x0 = min.x;
+            if (y0 < min.y) y0 = min.y;
+            if (z0 < min.z) z0 = min.z;
+            if (x1 >= max.x) x1 = max.x - 1;
+            if (y1 >= max.y) y1 = max.y - 1;
+            if (z1 >= max.z) z1 = max.z - 1;
+            struct voxel_box inside = {
+                .min = {.x = x0, .y = y0, .z = z0},
+                .extent = {.x = x1 - x0, .y = y1 - y0, .z = z1 - z0},
+            };
+            box_chunks(changed_chunks, &inside, 1);
+        }
+    }
+    voxel_box_count = kept;
+
+    /* bricks lie within one chunk, so they are either wholly inside or gone */
+    kept = 0;
+    for (unsigned int i = 0; i < brick_packet_count; ++i) {
+        struct brick_packet brick = brick_packets[i];
+        int x = brick.origin.x + offset.x, y = brick.origin.y + offset.y, z = brick.origin.z + offset.z;
+        if (x < min.x || x >= max.x || y < min.y || y >= max.y || z < min.z || z >= max.z) continue;
+        brick.origin.x = x;
+        brick.origin.y = y;
+        brick.origin.z = z;
+        brick_packets[kept++] = brick;
+    }
+    brick_packet_count = kept;
+
+    /* whatever follows the bricks can only move along once at a time */
+    if (brick_shift.x | brick_shift.y | brick_shift.z)
+        memset(repacked_chunks, 0xFF, sizeof(repacked_chunks));
+    brick_shift = (v_pos){brick_shift.x + offset.x, brick_shift.y + offset.y, brick_shift.z + offset.z};
+}
+
+void shift_voxels(v_pos offset, v_pos min, v_pos max) {
+    if (voxel_count == 0) return;
+
+    /* keys are taken before key_shift moves along with the voxels, so only
+       the voxels that leave the box have to come out of the index */
+    unsigned int i = 0;
+    while (i < voxel_count) {
+        struct gpu_voxel voxel = voxel_space[i];
+        v_pos pos = {voxel.x + offset.x, voxel.y + offset.y, voxel.z + offset.z};
+        if (pos.x < min.x || pos.x >= max.x || pos.y < min.y || pos.y >= max.y || pos.z < min.z || pos.z >= max.z) {
+            /* the last voxel, not yet moved, takes its place and is looked at next */
+            drop_voxel(find_slot(pack_key((v_pos){voxel.x, voxel.y, voxel.z})));
+            continue;
+        }
+
+        /* whatever was across the sides of the box has been dropped */
+        uint8_t faces = voxel_faces[i], exposed = faces;
+        if (pos.x == min.x) exposed |= 1 << FACE_LEFT;
+        if (pos.x == max.x - 1) exposed |= 1 << FACE_RIGHT;
+        if (pos.y == min.y) exposed |= 1 << FACE_TOP;
+        if (pos.y == max.y - 1) exposed |= 1 << FACE_BOTTOM;
+        if (pos.z == min.z) exposed |= 1 << FACE_BACK;
+        if (pos.z == max.z - 1) exposed |= 1 << FACE_FRONT;
+        if (faces == 0 && exposed != 0) --enclosed_voxel_count;
+        voxel_faces[i] = exposed;
+
+        voxel.x = pos.x;
+        voxel.y = pos.y;
+        voxel.z = pos.z;
+        voxel_space[i++] = voxel;
+    }
+    key_shift = (v_pos){
+        (key_shift.x - offset.x) & COORD_MASK,
+        (key_shift.y - offset.y) & COORD_MASK,
+        (key_shift.z - offset.z) & COORD_MASK
     };
+
+    const int chunk_mask = (1 << CHUNK_SHIFT) - 1;
+    if ((offset.x | offset.y | offset.z | min.x | min.y | min.z | max.x | max.y | max.z) & chunk_mask)
+        mark_all_changed();
+    else
+        shift_derived(offset, min, max);
+    ++voxel_revision;
+}
+
+static int compare_position(const void* a, const void* b) {
+    const struct gpu_voxel* va = &voxel_space[*(const uint32_t*)a];
+    const struct gpu_voxel* vb = &voxel_space[*(const uint32_t*)b];
+    if (va->z != vb->z) return va->z - vb->z;
+    if (va->y != vb->y) return va->y - vb->y;
+    return va->x - vb->x;
+}
+
+// voxel at pos can join a box of the given palette
+static int mergeable(v_pos pos, uint8_t palette) {
+    int index = find_voxel(pos);
+    return index >= 0 && !merged[index] && voxel_space[index].voxel_id == palette;
+}
+
+static int row_mergeable(v_pos pos, int size_x, uint8_t palette) {
+    for (int dx = 0; dx < size_x; ++dx)
+        if (!mergeable((v_pos){pos.x + dx, pos.y, pos.z}, palette)) return 0;
+    return 1;
+}
+
+unsigned int merge_voxel_boxes(void) {
+    if (merged_revision == voxel_revision && voxel_boxes != NULL)
+        return voxel_box_count;
+    merged_revision = voxel_revision;
+
+    if (voxel_count > merge_capacity || voxel_boxes == NULL) {
+        merge_capacity = voxel_space_size;
+        merge_order = (uint32_t*)realloc(merge_order, merge_capacity * sizeof(uint32_t));
+        merged = (uint8_t*)realloc(merged, merge_capacity * sizeof(uint8_t));
+        voxel_boxes = (struct voxel_box*)realloc(voxel_boxes, merge_capacity * sizeof(struct voxel_box));
+        if (merge_order == NULL || merged == NULL || voxel_boxes == NULL) {
+            printf("Failed to allocate memory for voxel boxes\n");
+            while (1);
+        }
+    }
+
+    /* boxes reaching into a changed chunk are merged again along with the
+       voxels of the changed chunks. every other voxel stays in its box, or
+       out of the boxes if it is enclosed, and is never grown into */
+    if (all_changed) {
+        memset(merged, 0, voxel_count);
+        memset(remerged_chunks, 0xFF, sizeof(remerged_chunks));
+        voxel_box_count = 0;
+    } else {
+        memset(merged, 1, voxel_count);
+        for (unsigned int i = 0; i < voxel_count; ++i)
+            if (chunk_marked(changed_chunks, voxel_chunk((v_pos){voxel_space[i].x, voxel_space[i].y, voxel_space[i].z})))
+                merged[i] = 0;
+        unsigned int kept = 0;
+        for (unsigned int i = 0; i < voxel_box_count; ++i) {
+            const struct voxel_box* box = &voxel_boxes[i];
+            if (!box_chunks(changed_chunks, box, 0)) {
+                voxel_boxes[kept++] = *box;
+                continue;
+            }
+            box_chunks(remerged_chunks, box, 1);
+            for (int dz = 0; dz <= box->extent.z; ++dz)
+                for (int dy = 0; dy <= box->extent.y; ++dy)
+                    for (int dx = 0; dx <= box->extent.x; ++dx) {
+                        int index = find_voxel((v_pos){box->min.x + dx, box->min.y + dy, box->min.z + dz});
+                        if (index >= 0) merged[index] = 0;
+                    }
+        }
+        voxel_box_count = kept;
+        for (unsigned int i = 0; i < sizeof(remerged_chunks); ++i)
+            remerged_chunks[i] |= changed_chunks[i];
+    }
+    memset(changed_chunks, 0, sizeof(changed_chunks));
+    all_changed = 0;
+
+    /* starting each box at the lowest unmerged voxel means
+       it only ever has to grow in the positive directions */
+    unsigned int order_count = 0;
+    for (unsigned int i = 0; i < voxel_count; ++i)
+        if (!merged[i]) merge_order[order_count++] = i;
+    qsort(merge_order, order_count, sizeof(uint32_t), compare_position);
+
+    const int max_coord = (1 << (COORD_BITS - 1)) - 1;
+    for (unsigned int i = 0; i < order_count; ++i) {
+        if (merged[merge_order[i]]) continue;
+        struct gpu_voxel start = voxel_space[merge_order[i]];
+        v_pos pos = {start.x, start.y, start.z};
+        uint8_t palette = start.voxel_id;
+
+        int size_x = 1, size_y = 1, size_z = 1;
+        while (pos.x + size_x <= max_coord
+            && mergeable((v_pos){pos.x + size_x, pos.y, pos.z}, palette))
+            ++size_x;
+        while (pos.y + size_y <= max_coord
+            && row_mergeable((v_pos){pos.x, pos.y + size_y, pos.z}, size_x, palette))
+            ++size_y;
+        while (pos.z + size_z <= max_coord) {
+            int solid = 1;
+            for (int dy = 0; dy < size_y && solid; ++dy)
+                solid = row_mergeable((v_pos){pos.x, pos.y + dy, pos.z + size_z}, size_x, palette);
+            if (!solid) break;
+            ++size_z;
+        }
+
+        uint8_t exposed = 0;
+        for (int dz = 0; dz < size_z; ++dz)
+            for (int dy = 0; dy < size_y; ++dy)
+                for (int dx = 0; dx < size_x; ++dx) {
+                    int index = find_voxel((v_pos){pos.x + dx, pos.y + dy, pos.z + dz});
+                    merged[index] = 1;
+                    exposed |= voxel_faces[index];
+                }
+
+        /* a box of enclosed voxels can never be the nearest hit */
+        if (exposed == 0) continue;
+
+        voxel_boxes[voxel_box_count++] = (struct voxel_box){
+            .min = start,
+            .extent = {.x = size_x - 1, .y = size_y - 1, .z = size_z - 1},
+        };
+    }
+    return voxel_box_count;
+}
+
+#define PACK_CELL_BITS 6
+#define PACK_REGION_BITS (COORD_BITS - 3)
+
+/* bricks are numbered region-major, so the bricks of each
+   8x8x8 region end up next to each other once sorted */
+static inline uint32_t brick_key(unsigned int x, unsigned int y, unsigned int z) {
+    uint32_t region = ((z >> 3) << (2 * PACK_REGION_BITS)) | ((y >> 3) << PACK_REGION_BITS) | (x >> 3);
+    return (region << 3) | (((z >> 2) & 1) << 2) | (((y >> 2) & 1) << 1) | ((x >> 2) & 1);
+}
+
+int box_in_bricks(const struct voxel_box* box) {
+    return (box->extent.x + 1) * (box->extent.y + 1) * (box->extent.z + 1) < BRICK_PACKET_VOXELS;
+}
+
+static int compare_key(const void* a, const void* b) {
+    uint32_t ka = *(const uint32_t*)a, kb = *(const uint32_t*)b;
+    return (ka > kb) - (ka < kb);
+}
+
+unsigned int pack_voxel_bricks(void) {
+    merge_voxel_boxes();
+    if (packed_revision == voxel_revision && brick_packets != NULL)
+        return brick_packet_count;
+    packed_revision = voxel_revision;
+
+    if (voxel_count > pack_capacity || brick_packets == NULL) {
+        pack_capacity = merge_capacity;
+        pack_keys = (uint32_t*)realloc(pack_keys, pack_capacity * sizeof(uint32_t));
+        brick_packets = (struct brick_packet*)realloc(brick_packets, pack_capacity * sizeof(struct brick_packet));
+        if (pack_keys == NULL || brick_packets == NULL) {
+            printf("Failed to allocate memory for brick packets\n");
+            while (1);
+        }
+    }
+
+    /* bricks lie within one chunk, so those of the chunks left alone keep their place */
+    unsigned int kept = 0;
+    for (unsigned int i = 0; i < brick_packet_count; ++i) {
+        const struct gpu_voxel* origin = &brick_packets[i].origin;
+        if (!chunk_marked(remerged_chunks, voxel_chunk((v_pos){origin->x, origin->y, origin->z})))
+            brick_packets[kept++] = brick_packets[i];
+    }
+
+    /* sorting by key groups the voxels of each brick and palette together */
+    const int offset = 1 << (COORD_BITS - 1);
+    unsigned int key_count = 0;
+    for (unsigned int i = 0; i < voxel_box_count; ++i) {
+        const struct voxel_box* box = &voxel_boxes[i];
+        if (!box_in_bricks(box) || !box_chunks(remerged_chunks, box, 0)) continue;
+        unsigned int x0 = box->min.x + offset, y0 = box->min.y + offset, z0 = box->min.z + offset;
+        for (unsigned int z = z0; z <= z0 + box->extent.z; ++z)
+            for (unsigned int y = y0; y <= y0 + box->extent.y; ++y)
+                for (unsigned int x = x0; x <= x0 + box->extent.x; ++x) {
+                    v_pos pos = {x - offset, y - offset, z - offset};
+                    if (!chunk_marked(remerged_chunks, voxel_chunk(pos)) || voxel_faces[find_voxel(pos)] == 0) continue;
+                    uint32_t brick = brick_key(x, y, z);
+                    uint32_t cell = ((z & 3) << 4) | ((y & 3) << 2) | (x & 3);
+                    pack_keys[key_count++] = (((brick << VOXEL_BITS) | box->min.voxel_id) << PACK_CELL_BITS) | cell;
+                }
+    }
+    qsort(pack_keys, key_count, sizeof(uint32_t), compare_key);
+
+    const uint32_t region_mask = (1 << PACK_REGION_BITS) - 1;
+    brick_packet_count = kept;
+    for (unsigned int i = 0; i < key_count; ++i) {
+        uint32_t group = pack_keys[i] >> PACK_CELL_BITS;
+        if (i == 0 || group != pack_keys[i - 1] >> PACK_CELL_BITS) {
+            uint32_t brick = group >> VOXEL_BITS;
+            uint32_t region = brick >> 3;
+            brick_packets[brick_packet_count++] = (struct brick_packet){
+                .origin = {
+                    .x = (((region & region_mask) << 3) | ((brick & 1) << 2)) - offset,
+                    .y = ((((region >> PACK_REGION_BITS) & region_mask) << 3) | (((brick >> 1) & 1) << 2)) - offset,
+                    .z = (((region >> (2 * PACK_REGION_BITS)) << 3) | (((brick >> 2) & 1) << 2)) - offset,
+                    .voxel_id = group & ((1 << VOXEL_BITS) - 1),
+                },
+                .mask = 0,
+            };
+        }
+        brick_packets[brick_packet_count - 1].mask |= (uint64_t)1 << (pack_keys[i] & ((1 << PACK_CELL_BITS) - 1));
+    }
+
+    for (unsigned int i = 0; i < sizeof(repacked_chunks); ++i)
+        repacked_chunks[i] |= remerged_chunks[i];
+    memset(remerged_chunks, 0, sizeof(remerged_chunks));
+    return brick_packet_count;
 }
 
 void init_voxel_list(void) {
     voxel_count = 0;
+    enclosed_voxel_count = 0;
     voxel_space_size = 256;
     voxel_space = calloc(voxel_space_size, sizeof(uint32_t));
+    voxel_faces = calloc(voxel_space_size, sizeof(uint8_t));
+    rebuild_index();
+    mark_all_changed();
+    ++voxel_revision;
 }
 
 void clear_voxel_list(void) {
@@ -36,5 +659,17 @@ void clear_voxel_list(void) {
         free(voxel_space);
         voxel_space = NULL;
     }
+    if (voxel_faces != NULL) {
+        free(voxel_faces);
+        voxel_faces = NULL;
+    }
+    if (voxel_index != NULL) {
+        free(voxel_index);
+        voxel_index = NULL;
+    }
     voxel_count = 0;
+    enclosed_voxel_count = 0;
+    key_shift = (v_pos){0, 0, 0};
+    mark_all_changed();
+    ++voxel_revision;
 }
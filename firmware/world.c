@@ -0,0 +1,376 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "firmware/world.h"
+
+unsigned int world_region_count;
+struct world_region* world_regions;
+unsigned int world_voxel_count;
+w_pos world_origin;
+
+static unsigned int region_capacity;
+static uint8_t window_loaded;   // whether the voxel space holds the window around world_origin
+static uint32_t window_epoch;   // bumped on every rebase, so regions loaded for an older window are stale
+
+/* region coordinates -> world_regions index + 1 (0 if empty),
+   open addressing with linear probing, kept at most half full */
+static uint32_t* region_slots;
+static unsigned int region_slot_mask;
+
+static struct gpu_voxel* window_voxels;     // voxels of a region gathered for the voxel space
+static unsigned int window_capacity;
+
+/* regions inside the window still to be moved into the voxel space, nearest the camera first */
+struct window_entry {
+    int32_t x, y, z;    // region coordinates
+    uint32_t distance;  // squared, in regions
+};
+static struct window_entry* window_queue;
+static unsigned int window_queue_head, window_queue_count;
+
+#define CELL_MASK (WORLD_REGION_SIZE - 1)
+#define PALETTE_MASK 0xFF
+
+static inline uint32_t region_hash(int32_t x, int32_t y, int32_t z) {
+    return ((uint32_t)x * 73856093u) ^ ((uint32_t)y * 19349663u) ^ ((uint32_t)z * 83492791u);
+}
+
+static uint32_t find_region_slot(int32_t x, int32_t y, int32_t z) {
+    uint32_t slot = region_hash(x, y, z) & region_slot_mask;
+    while (region_slots[slot] != 0) {
+        const struct world_region* region = &world_regions[region_slots[slot] - 1];
+        if (region->x == x && region->y == y && region->z == z) break;
+        slot = (slot + 1) & region_slot_mask;
+    }
+    return slot;
+}
+
+static void grow_region_slots(void) {
+    unsigned int capacity = region_slots ? (region_slot_mask + 1) * 2 : 64;
+    free(region_slots);
+    region_slots = (uint32_t*)calloc(capacity, sizeof(uint32_t));
+    if (region_slots == NULL) {
+        printf("Failed to allocate memory for world region index\n");
+        while (1);
+    }
+    region_slot_mask = capacity - 1;
+    for (unsigned int i = 0; i < world_region_count; ++i) {
+        const struct world_region* region = &world_regions[i];
+        region_slots[find_region_slot(region->x, region->y, region->z)] = i + 1;
+    }
+}
+
+static int region_in_window(const struct world_region* region) {
+    const int32_t half = WORLD_WINDOW_REGIONS / 2;
+    int32_t x = region->x - (world_origin.x >> WORLD_REGION_SHIFT);
+    int32_t y = region->y - (world_origin.y >> WORLD_REGION_SHIFT);
+    int32_t z = region->z - (world_origin.z >> WORLD_REGION_SHIFT);
+    return x >= -half && x < half && y >= -half && y < half && z >= -half && z < half;
+}
+
+// region holding (x, y, z) in region coordinates, NULL if it is empty and create is 0
+static struct world_region* get_region(int32_t x, int32_t y, int32_t z, int create) {
+    if (region_slots == NULL) {
+        if (!create) return NULL;
+        grow_region_slots();
+    }
+    uint32_t slot = find_region_slot(x, y, z);
+    if (region_slots[slot] != 0) return &world_regions[region_slots[slot] - 1];
+    if (!create) return NULL;
+
+    if (world_region_count == region_capacity) {
+        region_capacity = region_capacity ? region_capacity * 2 : 16;
+        world_regions = (struct world_region*)realloc(world_regions, region_capacity * sizeof(struct world_region));
+        if (world_regions == NULL) {
+            printf("Failed to allocate memory for world regions\n");
+            while (1);
+        }
+    }
+    world_regions[world_region_count] = (struct world_region){.x = x, .y = y, .z = z};
+    region_slots[slot] = ++world_region_count;
+    if (world_region_count * 2 > region_slot_mask + 1) grow_region_slots();
+
+    /* a new region is empty, so inside the window the voxel space already holds all of it */
+    struct world_region* region = &world_regions[world_region_count - 1];
+    if (window_loaded && region_in_window(region)) region->window = window_epoch;
+    return region;
+}
+
+static inline int region_loaded(const struct world_region* region) {
+    return window_loaded && region->window == window_epoch;
+}
+
+static inline uint32_t cell_of(w_pos pos) {
+    return ((uint32_t)(pos.z & CELL_MASK) << (2 * WORLD_REGION_SHIFT))
+        | ((uint32_t)(pos.y & CELL_MASK) << WORLD_REGION_SHIFT)
+        | (uint32_t)(pos.x & CELL_MASK);
+}
+
+// index of the first voxel of region whose cell is not below cell
+static unsigned int lower_bound(const struct world_region* region, uint32_t cell) {
+    unsigned int lo = 0, hi = region->count;
+    while (lo < hi) {
+        unsigned int mid = (lo + hi) / 2;
+        if ((region->voxels[mid] >> 8) < cell) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// whether pos is inside the window, writing its voxel space position to local if so
+static int to_window(w_pos pos, v_pos* local) {
+    const int32_t half = WORLD_WINDOW_HALF;
+    int32_t x = pos.x - world_origin.x, y = pos.y - world_origin.y, z = pos.z - world_origin.z;
+    if (x < -half || x >= half || y < -half || y >= half || z < -half || z >= half) return 0;
+    *local = (v_pos){x, y, z};
+    return 1;
+}
+
+static void reserve_region(struct world_region* region, unsigned int count) {
+    if (count <= region->capacity) return;
+    region->capacity = region->capacity ? region->capacity * 2 : 64;
+    while (region->capacity < count) region->capacity *= 2;
+    region->voxels = (uint32_t*)realloc(region->voxels, region->capacity * sizeof(uint32_t));
+    if (region->voxels == NULL) {
+        printf("Failed to allocate memory for world region voxels\n");
+        while (1);
+    }
+}
+
+static void store_voxel(w_pos pos, uint8_t palette) {
+    struct world_region* region = get_region(
+        pos.x >> WORLD_REGION_SHIFT, pos.y >> WORLD_REGION_SHIFT, pos.z >> WORLD_REGION_SHIFT, palette != 0
+    );
+    if (region == NULL) return;
+
+    uint32_t cell = cell_of(pos);
+    unsigned int i = lower_bound(region, cell);
+    int present = i < region->count && (region->voxels[i] >> 8) == cell;
+    if (palette == 0) {
+        if (!present) return;
+        memmove(&region->voxels[i], &region->voxels[i + 1], (region->count - i - 1) * sizeof(uint32_t));
+        --region->count;
+        --world_voxel_count;
+    } else if (present) {
+        region->voxels[i] = (cell << 8) | palette;
+    } else {
+        reserve_region(region, region->count + 1);
+        memmove(&region->voxels[i + 1], &region->voxels[i], (region->count - i) * sizeof(uint32_t));
+        region->voxels[i] = (cell << 8) | palette;
+        ++region->count;
+        ++world_voxel_count;
+    }
+    region->edited = 1;
+}
+
+int world_in_use(void) {
+    return window_loaded || world_voxel_count != 0;
+}
+
+int world_window_pos(w_pos pos, v_pos* local) {
+    if (!window_loaded || !to_window(pos, local)) return 0;
+    /* a region still queued gets the voxel from the world once it is moved in */
+    const struct world_region* region = get_region(
+        pos.x >> WORLD_REGION_SHIFT, pos.y >> WORLD_REGION_SHIFT, pos.z >> WORLD_REGION_SHIFT, 0
+    );
+    return region == NULL || region_loaded(region);
+}
+
+void world_set_voxel(w_pos pos, uint8_t palette) {
+    store_voxel(pos, palette);
+    v_pos local;
+    if (world_window_pos(pos, &local)) set_voxel(local, palette);
+}
+
+uint8_t world_get_voxel(w_pos pos) {
+    const struct world_region* region = get_region(
+        pos.x >> WORLD_REGION_SHIFT, pos.y >> WORLD_REGION_SHIFT, pos.z >> WORLD_REGION_SHIFT, 0
+    );
+    if (region == NULL) return 0;
+    uint32_t cell = cell_of(pos);
+    unsigned int i = lower_bound(region, cell);
+    return i < region->count && (region->voxels[i] >> 8) == cell ? region->voxels[i] & PALETTE_MASK : 0;
+}
+
+void world_load_voxels(const struct gpu_voxel* voxels, size_t count, w_pos offset) {
+    for (size_t i = 0; i < count; ++i) {
+        if (voxels[i].voxel_id == 0) continue;
+        store_voxel((w_pos){offset.x + voxels[i].x, offset.y + voxels[i].y, offset.z + voxels[i].z}, voxels[i].voxel_id);
+    }
+    window_loaded = 0;
+}
+
+void world_clear(void) {
+    for (unsigned int i = 0; i < world_region_count; ++i)
+        free(world_regions[i].voxels);
+    world_region_count = 0;
+    world_voxel_count = 0;
+    if (region_slots != NULL)
+        memset(region_slots, 0, (region_slot_mask + 1) * sizeof(uint32_t));
+    world_origin = (w_pos){0, 0, 0};
+    window_loaded = 0;
+    window_queue_head = window_queue_count = 0;
+}
+
+static void reserve_window(unsigned int count) {
+    if (count <= window_capacity) return;
+    window_capacity = count;
+    window_voxels = (struct gpu_voxel*)realloc(window_voxels, window_capacity * sizeof(struct gpu_voxel));
+    if (window_voxels == NULL) {
+        printf("Failed to allocate memory for world window\n");
+        while (1);
+    }
+}
+
+// writes the voxels of a region inside the window to out, in voxel space coordinates
+static unsigned int gather_region(const struct world_region* region, struct gpu_voxel* out) {
+    int32_t bx = (region->x << WORLD_REGION_SHIFT) - world_origin.x;
+    int32_t by = (region->y << WORLD_REGION_SHIFT) - world_origin.y;
+    int32_t bz = (region->z << WORLD_REGION_SHIFT) - world_origin.z;
+    for (unsigned int i = 0; i < region->count; ++i) {
+        uint32_t cell = region->voxels[i] >> 8;
+        out[i] = (struct gpu_voxel){
+            .x = bx + (cell & CELL_MASK),
+            .y = by + ((cell >> WORLD_REGION_SHIFT) & CELL_MASK),
+            .z = bz + (cell >> (2 * WORLD_REGION_SHIFT)),
+            .voxel_id = region->voxels[i] & PALETTE_MASK,
+        };
+    }
+    return region->count;
+}
+
+static void load_region_into_window(struct world_region* region) {
+    reserve_window(region->count);
+    load_voxels(window_voxels, gather_region(region, window_voxels));
+    region->window = window_epoch;
+}
+
+struct world_region* world_find_region(int32_t x, int32_t y, int32_t z) {
+    return get_region(x, y, z, 0);
+}
+
+struct world_region* world_add_region(int32_t x, int32_t y, int32_t z, const uint32_t* voxels, unsigned int count) {
+    if (get_region(x, y, z, 0) != NULL) return NULL;
+    struct world_region* region = get_region(x, y, z, 1);
+    reserve_region(region, count);
+    memcpy(region->voxels, voxels, count * sizeof(uint32_t));
+    region->count = count;
+    world_voxel_count += count;
+
+    if (region_loaded(region)) load_region_into_window(region);
+    return region;
+}
+
+void world_remove_region(struct world_region* region) {
+    if (region_loaded(region)) {
+        reserve_window(region->count);
+        unsigned int count = gather_region(region, window_voxels);
+        for (unsigned int i = 0; i < count; ++i)
+            remove_voxel((v_pos){window_voxels[i].x, window_voxels[i].y, window_voxels[i].z});
+    }
+    world_voxel_count -= region->count;
+    free(region->voxels);
+
+    /* backward-shift deletion keeps every probe chain unbroken */
+    uint32_t hole = find_region_slot(region->x, region->y, region->z);
+    uint32_t index = region_slots[hole] - 1;
+    for (uint32_t slot = (hole + 1) & region_slot_mask; region_slots[slot] != 0; slot = (slot + 1) & region_slot_mask) {
+        const struct world_region* other = &world_regions[region_slots[slot] - 1];
+        uint32_t home = region_hash(other->x, other->y, other->z) & region_slot_mask;
+        if (((slot - home) & region_slot_mask) >= ((slot - hole) & region_slot_mask)) {
+            region_slots[hole] = region_slots[slot];
+            hole = slot;
+        }
+    }
+    region_slots[hole] = 0;
+
+    /* the last region moves into the freed entry */
+    if (index != --world_region_count) {
+        world_regions[index] = world_regions[world_region_count];
+        const struct world_region* moved = &world_regions[index];
+        region_slots[find_region_slot(moved->x, moved->y, moved->z)] = index + 1;
+    }
+}
+
+static int compare_window_entry(const void* a, const void* b) {
+    uint32_t da = ((const struct window_entry*)a)->distance, db = ((const struct window_entry*)b)->distance;
+    return (da > db) - (da < db);
+}
+
+void world_rebase(w_pos pos) {
+    /* round to the nearest region corner */
+    const int32_t round = WORLD_REGION_SIZE / 2;
+    w_pos old_origin = world_origin;
+    world_origin = (w_pos){
+        (pos.x + round) & ~CELL_MASK,
+        (pos.y + round) & ~CELL_MASK,
+        (pos.z + round) & ~CELL_MASK,
+    };
+
+    /* voxel space positions are relative to world_origin, so the voxels the windows share
+       move by the change in origin; regions loaded for the old window are only still loaded
+       if they are restamped below */
+    const int32_t half = WORLD_WINDOW_HALF;
+    int32_t dx = world_origin.x - old_origin.x, dy = world_origin.y - old_origin.y, dz = world_origin.z - old_origin.z;
+    int shifted = window_loaded && dx > -2 * half && dx < 2 * half && dy > -2 * half && dy < 2 * half
+        && dz > -2 * half && dz < 2 * half;
+    uint32_t old_epoch = window_epoch++;
+    if (shifted) {
+        shift_voxels((v_pos){-dx, -dy, -dz}, (v_pos){-half, -half, -half}, (v_pos){half, half, half});
+    } else {
+        clear_voxel_list();
+        init_voxel_list();
+    }
+    window_loaded = 1;
+
+    /* regions wholly inside the window, walked through the region index
+       rather than world_regions so the cost follows the window, not the world */
+    if (window_queue == NULL) {
+        window_queue = (struct window_entry*)malloc(
+            WORLD_WINDOW_REGIONS * WORLD_WINDOW_REGIONS * WORLD_WINDOW_REGIONS * sizeof(struct window_entry)
+        );
+        if (window_queue == NULL) {
+            printf("Failed to allocate memory for world window queue\n");
+            while (1);
+        }
+    }
+    const int32_t half_regions = WORLD_WINDOW_REGIONS / 2;
+    int32_t rx = world_origin.x >> WORLD_REGION_SHIFT;
+    int32_t ry = world_origin.y >> WORLD_REGION_SHIFT;
+    int32_t rz = world_origin.z >> WORLD_REGION_SHIFT;
+    int32_t cx = pos.x >> WORLD_REGION_SHIFT, cy = pos.y >> WORLD_REGION_SHIFT, cz = pos.z >> WORLD_REGION_SHIFT;
+    window_queue_head = window_queue_count = 0;
+    for (int32_t z = rz - half_regions; z < rz + half_regions; ++z)
+        for (int32_t y = ry - half_regions; y < ry + half_regions; ++y)
+            for (int32_t x = rx - half_regions; x < rx + half_regions; ++x) {
+                struct world_region* region = get_region(x, y, z, 0);
+                if (region == NULL) continue;
+                /* only loaded for the old window if it was inside it, so it was shifted along */
+                if (shifted && region->window == old_epoch) {
+                    region->window = window_epoch;
+                    continue;
+                }
+                uint32_t distance = (x - cx) * (x - cx) + (y - cy) * (y - cy) + (z - cz) * (z - cz);
+                window_queue[window_queue_count++] = (struct window_entry){x, y, z, distance};
+            }
+    qsort(window_queue, window_queue_count, sizeof(struct window_entry), compare_window_entry);
+}
+
+unsigned int world_follow_camera(float x, float y, float z) {
+    if (world_voxel_count == 0) return 0;
+    const float limit = WORLD_REBASE_DISTANCE;
+    float dx = x - world_origin.x, dy = y - world_origin.y, dz = z - world_origin.z;
+    if (!window_loaded || dx <= -limit || dx >= limit || dy <= -limit || dy >= limit || dz <= -limit || dz >= limit)
+        world_rebase((w_pos){(int32_t)x, (int32_t)y, (int32_t)z});
+
+    /* always make some progress, but stop once the budget is spent */
+    unsigned int loaded = 0;
+    while (window_queue_head < window_queue_count && loaded < WORLD_WINDOW_BUDGET) {
+        const struct window_entry* entry = &window_queue[window_queue_head++];
+        struct world_region* region = get_region(entry->x, entry->y, entry->z, 0);
+        if (region == NULL || region_loaded(region)) continue;
+        load_region_into_window(region);
+        loaded += region->count;
+    }
+    return window_queue_count - window_queue_head;
+}
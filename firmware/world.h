@@ -0,0 +1,167 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "hardware/hardware.h"
+#include "firmware/firmware.h"
+
+/*
+ * the world holds voxels at 32-bit coordinates, in regions of
+ * 64x64x64 voxels. the voxel space only ever holds the window of
+ * 2 * WORLD_WINDOW_HALF voxels per axis around world_origin, translated
+ * so that world_origin lands on voxel (0, 0, 0). world_origin is always
+ * a multiple of the region size, so every region is either wholly inside
+ * the window or wholly outside.
+ * the camera still moves in float world coordinates, which stay
+ * finer than a voxel up to about 2^23 from zero.
+ */
+#define WORLD_REGION_SHIFT 6
+#define WORLD_REGION_SIZE (1 << WORLD_REGION_SHIFT)
+
+/* the window is moved once the camera strays this far from its centre */
+#define WORLD_REBASE_DISTANCE 64
+
+/* the camera stays within WORLD_REBASE_DISTANCE of world_origin, so this keeps
+   every voxel within SIDE_LEN / 2 of the camera, as far as the GPU's signed
+   fixed point camera math reaches. the camera always sees at least
+   WORLD_WINDOW_HALF - WORLD_REBASE_DISTANCE voxels in every direction */
+#define WORLD_WINDOW_HALF (SIDE_LEN / 2 - WORLD_REBASE_DISTANCE)
+#define WORLD_WINDOW_REGIONS (2 * WORLD_WINDOW_HALF / WORLD_REGION_SIZE)
+_Static_assert(WORLD_WINDOW_HALF % WORLD_REGION_SIZE == 0, "the window must hold whole regions");
+_Static_assert(WORLD_REGION_SIZE % (1 << CHUNK_SHIFT) == 0, "a rebase must move whole chunks");
+
+/* voxels moved into the voxel space per world_follow_camera while regions
+   entering the window are filled in, at least one region's worth, as world_stream_update reads */
+#define WORLD_WINDOW_BUDGET 16384
+
+typedef struct w_pos {
+    int32_t x;
+    int32_t y;
+    int32_t z;
+} w_pos;
+
+/**
+ * a region of the world. each of its voxels is one word,
+ * the cell index (z << 12 | y << 6 | x) above the palette index
+ * in the low 8 bits, and voxels are sorted by cell.
+ */
+struct world_region {
+    int32_t x, y, z;    // region coordinates, i.e. min corner >> WORLD_REGION_SHIFT
+    unsigned int count;
+    unsigned int capacity;
+    uint32_t* voxels;
+    uint32_t last_used; // left to the region's owner, e.g. for streaming
+    uint32_t window;    // the window it was last moved into the voxel space for
+    uint8_t edited;     // changed since world_add_region added it, so it can't be read back
+};
+
+extern unsigned int world_region_count;
+extern struct world_region* world_regions;
+extern unsigned int world_voxel_count;
+
+/**
+ * world position of voxel (0, 0, 0) of the voxel space.
+ */
+extern w_pos world_origin;
+
+/**
+ * sets the voxel at pos to palette, or removes it if palette is 0.
+ * if pos is inside the loaded window, the voxel space is updated as well.
+ * @param pos world position of the voxel
+ * @param palette palette index to set the voxel to
+ */
+void world_set_voxel(w_pos pos, uint8_t palette);
+
+/**
+ * @param pos world position of the voxel
+ * @return palette index of the voxel at pos, or 0 if it is empty
+ */
+uint8_t world_get_voxel(w_pos pos);
+
+/**
+ * @param pos world position of a voxel
+ * @param local set to the voxel space position of pos, if it is in the window
+ * @return whether pos is inside the window and the voxel space already holds its region
+ */
+int world_window_pos(w_pos pos, v_pos* local);
+
+/**
+ * @return whether the voxel space holds the window around world_origin, or will
+ * once world_follow_camera next runs. if not, it holds a scene loaded straight into it
+ */
+int world_in_use(void);
+
+/**
+ * adds a table of voxels to the world, each moved by offset.
+ * voxels with palette 0 are skipped. the voxel space is
+ * reloaded by the next call to world_follow_camera.
+ * @param voxels voxels to add
+ * @param count number of voxels in the table
+ * @param offset world position that voxel (0, 0, 0) of the table lands on
+ */
+void world_load_voxels(const struct gpu_voxel* voxels, size_t count, w_pos offset);
+
+/**
+ * @param x region coordinate, i.e. world position >> WORLD_REGION_SHIFT
+ * @param y region coordinate
+ * @param z region coordinate
+ * @return the region, or NULL if it holds no voxels
+ */
+struct world_region* world_find_region(int32_t x, int32_t y, int32_t z);
+
+/**
+ * adds a whole region at once. its voxels go straight into
+ * the voxel space if the region is inside the window.
+ * pointers to other regions may be invalidated.
+ * @param x region coordinate
+ * @param y region coordinate
+ * @param z region coordinate
+ * @param voxels voxels of the region, sorted as in struct world_region
+ * @param count number of voxels
+ * @return the new region, or NULL if the region already exists
+ */
+struct world_region* world_add_region(int32_t x, int32_t y, int32_t z, const uint32_t* voxels, unsigned int count);
+
+/**
+ * drops a region and its voxels, taking them out of the voxel space
+ * if they were loaded into it. the last region of
+ * world_regions is moved into its entry.
+ * @param region region to drop
+ */
+void world_remove_region(struct world_region* region);
+
+/**
+ * empties the world and moves world_origin back to (0, 0, 0).
+ * the voxel space is left alone.
+ */
+void world_clear(void);
+
+/**
+ * moves world_origin to the region corner nearest pos. voxels of the
+ * regions both windows share are shifted where they stay loaded, those
+ * of regions leaving the window are dropped, and the regions entering it
+ * are queued, nearest pos first. world_follow_camera then moves them into
+ * the voxel space, WORLD_WINDOW_BUDGET voxels at a time. the first rebase
+ * after the world changes in bulk empties the voxel space and queues the
+ * whole window instead.
+ * @param pos new centre of the window
+ */
+void world_rebase(w_pos pos);
+
+/**
+ * rebases the window if it has not been loaded since the world last
+ * changed in bulk, or if the camera has strayed more than
+ * WORLD_REBASE_DISTANCE from world_origin along any axis,
+ * then moves queued regions into the voxel space until
+ * WORLD_WINDOW_BUDGET voxels have been moved.
+ * does nothing while the world is empty, so scenes loaded
+ * straight into the voxel space are never replaced.
+ * @param x camera position in world coordinates
+ * @param y camera position in world coordinates
+ * @param z camera position in world coordinates
+ * @return number of regions still waiting to be moved into the voxel space
+ */
+unsigned int world_follow_camera(float x, float y, float z);
+
+#endif
@@ -0,0 +1,298 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "firmware/world_stream.h"
+#include "firmware/palette.h"
+
+unsigned int world_stream_loads;
+unsigned int world_stream_evictions;
+
+static int (*read_at)(uint32_t offset, void* buffer, uint32_t size);
+static FILE* stream_file;
+static const uint8_t* stream_image;
+static size_t stream_size;      // of the file or image, in bytes
+
+static struct world_file_region* file_index;
+static uint32_t file_region_count;
+
+/* regions around the camera waiting to be read, nearest first */
+struct queued_region {
+    uint32_t entry;     // index into file_index
+    uint32_t distance;  // squared, in regions
+};
+static struct queued_region* queue;
+static unsigned int queue_head, queue_count, queue_capacity;
+
+static uint8_t camera_known;
+static int32_t camera_x, camera_y, camera_z;   // region holding the camera at the last update
+static uint32_t epoch;                          // bumped whenever the camera changes region
+
+static uint32_t* run_buffer;
+static uint32_t* cell_buffer;
+static unsigned int run_capacity, cell_capacity;
+
+#define RUN_CELL_SHIFT 14
+#define RUN_PALETTE_SHIFT 6
+#define RUN_LENGTH_MASK 0x3F
+
+static int read_file(uint32_t offset, void* buffer, uint32_t size) {
+    if (fseek(stream_file, offset, SEEK_SET) != 0) return -1;
+    return fread(buffer, 1, size, stream_file) == size ? 0 : -1;
+}
+
+// one block of the image, zero past its end, as a block device would return it
+static void read_block(uint32_t block, uint8_t out[WORLD_STREAM_BLOCK]) {
+    size_t start = (size_t)block * WORLD_STREAM_BLOCK;
+    size_t size = start < stream_size ? stream_size - start : 0;
+    if (size > WORLD_STREAM_BLOCK) size = WORLD_STREAM_BLOCK;
+    memcpy(out, stream_image + start, size);
+    memset(out + size, 0, WORLD_STREAM_BLOCK - size);
+}
+
+static int read_image(uint32_t offset, void* buffer, uint32_t size) {
+    if ((size_t)offset + size > stream_size) return -1;
+    uint8_t block[WORLD_STREAM_BLOCK];
+    uint8_t* out = (uint8_t*)buffer;
+    while (size > 0) {
+        uint32_t skip = offset % WORLD_STREAM_BLOCK;
+        uint32_t take = WORLD_STREAM_BLOCK - skip < size ? WORLD_STREAM_BLOCK - skip : size;
+        read_block(offset / WORLD_STREAM_BLOCK, block);
+        memcpy(out, block + skip, take);
+        out += take;
+        offset += take;
+        size -= take;
+    }
+    return 0;
+}
+
+static void* grow(void* buffer, unsigned int* capacity, unsigned int count, size_t size) {
+    if (count <= *capacity) return buffer;
+    *capacity = count;
+    buffer = realloc(buffer, (size_t)count * size);
+    if (buffer == NULL) {
+        printf("Failed to allocate memory for world stream\n");
+        while (1);
+    }
+    return buffer;
+}
+
+static int open_stream(void) {
+    struct world_file_header header;
+    if (read_at(0, &header, sizeof(header)) != 0
+        || memcmp(header.magic, WORLD_FILE_MAGIC, sizeof(header.magic)) != 0
+        || header.version != WORLD_FILE_VERSION) {
+        printf("Not a world file\n");
+        return -1;
+    }
+
+    /* entries past what voxel_id can index are ignored */
+    uint16_t palette[1 << VOXEL_BITS];
+    unsigned int palette_count = header.palette_size < (1 << VOXEL_BITS) ? header.palette_size : (1 << VOXEL_BITS);
+    uint32_t index_offset = sizeof(header) + ((header.palette_size * sizeof(uint16_t) + 3) & ~3u);
+    /* the index has to fit in the file, which also keeps the allocation below from overflowing */
+    if (index_offset > stream_size
+        || header.region_count > (stream_size - index_offset) / sizeof(struct world_file_region)) {
+        printf("World file is truncated\n");
+        return -1;
+    }
+    free(file_index);
+    file_index = (struct world_file_region*)malloc((header.region_count + 1) * sizeof(struct world_file_region));
+    if (file_index == NULL) {
+        printf("Failed to allocate memory for world index\n");
+        while (1);
+    }
+    if (read_at(sizeof(header), palette, palette_count * sizeof(uint16_t)) != 0
+        || read_at(index_offset, file_index, header.region_count * sizeof(struct world_file_region)) != 0) {
+        printf("World file is truncated\n");
+        return -1;
+    }
+
+    /* so are the runs of every region, and each run holds at least one voxel */
+    for (uint32_t i = 0; i < header.region_count; ++i) {
+        const struct world_file_region* entry = &file_index[i];
+        if (entry->offset > stream_size || entry->run_count > (stream_size - entry->offset) / sizeof(uint32_t)
+            || entry->run_count > entry->voxel_count
+            || entry->voxel_count > WORLD_REGION_SIZE * WORLD_REGION_SIZE * WORLD_REGION_SIZE) {
+            printf("World file is corrupt\n");
+            return -1;
+        }
+    }
+    for (unsigned int i = 0; i < palette_count; ++i)
+        palette_data[i] = palette[i];
+    file_region_count = header.region_count;
+
+    world_clear();
+    queue_head = queue_count = 0;
+    camera_known = 0;
+    return 0;
+}
+
+int world_stream_open_file(const char* path) {
+    world_stream_close();
+    stream_file = fopen(path, "rb");
+    if (stream_file == NULL) {
+        printf("Failed to open world %s\n", path);
+        return -1;
+    }
+    long size = fseek(stream_file, 0, SEEK_END) == 0 ? ftell(stream_file) : -1;
+    if (size < 0) {
+        printf("Failed to read world %s\n", path);
+        world_stream_close();
+        return -1;
+    }
+    stream_size = size;
+    read_at = read_file;
+    if (open_stream() != 0) {
+        world_stream_close();
+        return -1;
+    }
+    return 0;
+}
+
+int world_stream_open_image(const void* image, size_t size) {
+    world_stream_close();
+    stream_image = (const uint8_t*)image;
+    stream_size = size;
+    read_at = read_image;
+    if (open_stream() != 0) {
+        world_stream_close();
+        return -1;
+    }
+    return 0;
+}
+
+void world_stream_close(void) {
+    if (stream_file != NULL) fclose(stream_file);
+    stream_file = NULL;
+    stream_image = NULL;
+    read_at = NULL;
+    file_region_count = 0;
+    queue_head = queue_count = 0;
+}
+
+// index entry of region (x, y, z), or file_region_count if the file has none
+static uint32_t find_entry(int32_t x, int32_t y, int32_t z) {
+    uint32_t lo = 0, hi = file_region_count;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        const struct world_file_region* entry = &file_index[mid];
+        int below = entry->z != z ? entry->z < z : entry->y != y ? entry->y < y : entry->x < x;
+        if (below) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo < file_region_count && file_index[lo].x == x && file_index[lo].y == y && file_index[lo].z == z)
+        return lo;
+    return file_region_count;
+}
+
+static int compare_distance(const void* a, const void* b) {
+    uint32_t da = ((const struct queued_region*)a)->distance, db = ((const struct queued_region*)b)->distance;
+    return (da > db) - (da < db);
+}
+
+/* marks the resident regions around the camera as used
+   and queues the missing ones, nearest first */
+static void refill_queue(void) {
+    const int r = WORLD_STREAM_RADIUS;
+    unsigned int side = 2 * r + 1;
+    queue = (struct queued_region*)grow(queue, &queue_capacity, side * side * side, sizeof(struct queued_region));
+
+    queue_head = queue_count = 0;
+    for (int dz = -r; dz <= r; ++dz)
+        for (int dy = -r; dy <= r; ++dy)
+            for (int dx = -r; dx <= r; ++dx) {
+                uint32_t distance = dx * dx + dy * dy + dz * dz;
+                if (distance > (uint32_t)(r * r)) continue;
+                int32_t x = camera_x + dx, y = camera_y + dy, z = camera_z + dz;
+                struct world_region* region = world_find_region(x, y, z);
+                if (region != NULL) {
+                    region->last_used = epoch;
+                    continue;
+                }
+                uint32_t entry = find_entry(x, y, z);
+                if (entry != file_region_count)
+                    queue[queue_count++] = (struct queued_region){entry, distance};
+            }
+    qsort(queue, queue_count, sizeof(struct queued_region), compare_distance);
+}
+
+// reads one region from the file, returning how many voxels it added
+static unsigned int load_region(const struct world_file_region* entry) {
+    run_buffer = (uint32_t*)grow(run_buffer, &run_capacity, entry->run_count, sizeof(uint32_t));
+    cell_buffer = (uint32_t*)grow(cell_buffer, &cell_capacity, entry->voxel_count, sizeof(uint32_t));
+    if (read_at(entry->offset, run_buffer, entry->run_count * sizeof(uint32_t)) != 0) {
+        printf("Failed to read world region %ld %ld %ld\n", (long)entry->x, (long)entry->y, (long)entry->z);
+        return 0;
+    }
+
+    /* runs must stay on their row, in order, and hold palettes voxel_id can index */
+    unsigned int count = 0;
+    uint32_t next_cell = 0;
+    for (uint32_t i = 0; i < entry->run_count; ++i) {
+        uint32_t run = run_buffer[i];
+        uint32_t cell = run >> RUN_CELL_SHIFT;
+        uint32_t voxel = (run >> RUN_PALETTE_SHIFT) & 0xFF;
+        uint32_t length = (run & RUN_LENGTH_MASK) + 1;
+        if ((cell & (WORLD_REGION_SIZE - 1)) + length > WORLD_REGION_SIZE || count + length > entry->voxel_count
+            || cell < next_cell || voxel == 0 || voxel >= (1 << VOXEL_BITS)) {
+            printf("World region %ld %ld %ld is corrupt\n", (long)entry->x, (long)entry->y, (long)entry->z);
+            return 0;
+        }
+        for (uint32_t k = 0; k < length; ++k)
+            cell_buffer[count++] = ((cell + k) << 8) | voxel;
+        next_cell = cell + length;
+    }
+
+    struct world_region* region = world_add_region(entry->x, entry->y, entry->z, cell_buffer, count);
+    if (region == NULL) return 0;
+    region->last_used = epoch;
+    ++world_stream_loads;
+    return count;
+}
+
+// evicts regions until few enough voxels are resident or budget voxels have been evicted
+static void evict_regions(unsigned int budget) {
+    unsigned int evicted = 0;
+    while (world_voxel_count > WORLD_STREAM_MAX_VOXELS && evicted < budget) {
+        /* regions around the camera carry the current epoch and are never evicted */
+        struct world_region* oldest = NULL;
+        for (unsigned int i = 0; i < world_region_count; ++i) {
+            struct world_region* region = &world_regions[i];
+            /* nor are edited regions, which could only be read back without their edits */
+            if (region->edited || region->last_used == epoch) continue;
+            if (oldest == NULL || region->last_used < oldest->last_used)
+                oldest = region;
+        }
+        if (oldest == NULL) return;
+        evicted += oldest->count;
+        world_remove_region(oldest);
+        ++world_stream_evictions;
+    }
+}
+
+unsigned int world_stream_update(float x, float y, float z) {
+    if (read_at == NULL) return 0;
+
+    int32_t rx = (int32_t)floorf(x) >> WORLD_REGION_SHIFT;
+    int32_t ry = (int32_t)floorf(y) >> WORLD_REGION_SHIFT;
+    int32_t rz = (int32_t)floorf(z) >> WORLD_REGION_SHIFT;
+    if (!camera_known || rx != camera_x || ry != camera_y || rz != camera_z) {
+        camera_known = 1;
+        camera_x = rx;
+        camera_y = ry;
+        camera_z = rz;
+        ++epoch;
+        refill_queue();
+    }
+
+    /* always make some progress, but stop once the budget is spent */
+    unsigned int loaded = 0;
+    while (queue_head < queue_count && loaded < WORLD_STREAM_BUDGET) {
+        const struct world_file_region* entry = &file_index[queue[queue_head++].entry];
+        if (world_find_region(entry->x, entry->y, entry->z) != NULL) continue;
+        loaded += load_region(entry);
+    }
+    evict_regions(WORLD_STREAM_BUDGET);
+    return queue_count - queue_head;
+}
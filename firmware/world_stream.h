@@ -0,0 +1,83 @@
+#ifndef WORLD_STREAM_H
+#define WORLD_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "firmware/world.h"
+
+/*
+ * world file format (.vxw), little-endian:
+ *   struct world_file_header
+ *   uint16_t palette[palette_size], padded to a multiple of 4 bytes
+ *   struct world_file_region index[region_count], sorted by z, then y, then x
+ *   region data, each region a run of words (cell << 14 | palette << 6 | length - 1)
+ *   going along +x from cell, sorted by cell, cell laid out as in struct world_region
+ */
+#define WORLD_FILE_MAGIC "VXW1"
+#define WORLD_FILE_VERSION 1
+
+struct world_file_header {
+    char magic[4];
+    uint16_t version;
+    uint16_t palette_size;  // entries, including the blank entry 0
+    uint32_t region_count;
+};
+
+struct world_file_region {
+    int32_t x, y, z;        // region coordinates
+    uint32_t offset;        // of the region's runs from the start of the file
+    uint32_t run_count;
+    uint32_t voxel_count;
+};
+
+/* regions within this many regions of the camera's region are kept resident */
+#define WORLD_STREAM_RADIUS 4
+/* voxels read per world_stream_update, at least one region's worth,
+   so frame time does not depend on how fast the camera moves */
+#define WORLD_STREAM_BUDGET WORLD_WINDOW_BUDGET
+/* least recently used regions are evicted past this many resident voxels */
+#define WORLD_STREAM_MAX_VOXELS (1 << 18)
+/* the stand-in block device is read in blocks of this many bytes */
+#define WORLD_STREAM_BLOCK 512
+
+extern unsigned int world_stream_loads;
+extern unsigned int world_stream_evictions;
+
+/**
+ * opens a world file and reads its palette and region index, emptying the world.
+ * the file is read through stdio, which goes through semihosting on the board.
+ * @param path path of the .vxw file
+ * @return 0 on success, -1 if the file cannot be read, is not a world file
+ * or its index does not fit in it
+ */
+int world_stream_open_file(const char* path);
+
+/**
+ * opens a world file image already in memory, read block by block
+ * as from a block device, emptying the world.
+ * @param image world file contents, 4-byte aligned
+ * @param size size of image in bytes
+ * @return 0 on success, -1 if image is not a world file or its index does not fit in it
+ */
+int world_stream_open_image(const void* image, size_t size);
+
+/**
+ * stops streaming. resident regions stay in the world.
+ */
+void world_stream_close(void);
+
+/**
+ * queues the regions around the camera that are not resident yet,
+ * nearest first, reads them until WORLD_STREAM_BUDGET voxels are read and evicts
+ * the least recently used regions beyond WORLD_STREAM_MAX_VOXELS, again
+ * until WORLD_STREAM_BUDGET voxels are evicted.
+ * regions within WORLD_STREAM_RADIUS are never evicted, even past the limit.
+ * regions are never written back, so edited regions are never evicted either.
+ * @param x camera position in world coordinates
+ * @param y camera position in world coordinates
+ * @param z camera position in world coordinates
+ * @return number of regions still waiting to be read
+ */
+unsigned int world_stream_update(float x, float y, float z);
+
+#endif
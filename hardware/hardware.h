@@ -26,6 +26,10 @@ enum render_status { RS_READY = 0, RS_WORKING = 1, RS_ERROR = 2 };
 #define COORD_BITS 10
 #define FRACT_BITS COORD_BITS
 #define PIXEL_BITS 16
+// width of voxel_extent[1:0], which voxel_gpu.sv reads as the brick cell size
+#define BRICK_SCALE_BITS 2
+// fraction bits of the 16-bit depths written to depth_buffer
+#define GPU_DEPTH_FRACT_BITS (16 - COORD_BITS)
 
 PA_STRUCT gpu_voxel {
     uint32_t voxel_id : VOXEL_BITS;
@@ -35,6 +39,34 @@ PA_STRUCT gpu_voxel {
 };
 assert_word_size(struct gpu_voxel, "Voxel type");
 
+// Size of the box drawn for the next rasterize_voxel writes, each axis
+// holding the extent minus one so that all zeroes is a unit voxel.
+// Bricks ignore the extent and are instead 4 cells of 2^brick_scale voxels wide
+PA_STRUCT gpu_box_extent {
+    uint32_t brick_scale : BRICK_SCALE_BITS;
+    uint32_t z : COORD_BITS;
+    uint32_t y : COORD_BITS;
+    uint32_t x : COORD_BITS;
+};
+assert_word_size(struct gpu_box_extent, "Box extent type");
+
+// Voxel offset from packet_origin, sent two to a word through rasterize_packets.
+// A packet of voxel type 0 is padding and draws nothing
+struct __attribute__((__packed__)) gpu_voxel_packet {
+    uint16_t voxel_id : VOXEL_BITS;
+    uint16_t : (4 - VOXEL_BITS);
+    uint16_t z : 4;
+    uint16_t y : 4;
+    uint16_t x : 4;
+};
+_Static_assert(sizeof(struct gpu_voxel_packet) == sizeof(uint16_t), "Voxel packet type must be half word size");
+
+PA_STRUCT gpu_packet_pair {
+    struct gpu_voxel_packet first;
+    struct gpu_voxel_packet second;
+};
+assert_word_size(struct gpu_packet_pair, "Voxel packet pair type");
+
 PA_STRUCT gpu_palette_entry {
     uint32_t voxel_id : VOXEL_BITS;
     uint32_t : (sizeof(uint32_t) * 8 - PIXEL_BITS - VOXEL_BITS);
@@ -64,8 +96,69 @@ PA_STRUCT gpu_registers {
      * the chunk (triggers linear interpolation routines)
      */
     uint32_t start_pixel;
-    // reserved space
-    uint32_t _reserved_0x10_0x3C[11];
+    /**
+     * Extent of the box drawn by rasterize_voxel, with rasterize_voxel as
+     * its min corner. Keeps its value until written again (starts as a unit voxel)
+     */
+    struct gpu_box_extent voxel_extent;
+    /**
+     * Occupancy of the brick drawn by rasterize_brick, low word first.
+     * Cell (x, y, z) of the brick is bit z * 16 + y * 4 + x
+     */
+    uint32_t brick_mask[2];
+    /**
+     * Write to this register to rasterize the 4x4x4 brick with the written
+     * min corner, drawing the cells set in brick_mask in the written voxel type.
+     * The cell size comes from voxel_extent.brick_scale
+     */
+    struct gpu_voxel rasterize_brick;
+    /**
+     * Min corner of the 16x16x16 brick that rasterize_packets offsets its
+     * voxels from. Keeps its value until written again
+     */
+    struct gpu_voxel packet_origin;
+    /**
+     * Write to this register to rasterize the two written voxels, first then
+     * second, each drawn as rasterize_voxel would draw it
+     */
+    struct gpu_packet_pair rasterize_packets;
+    /**
+     * Write to this register to recompute the rays of the current chunk from
+     * camera, without clearing what has already been rasterized. Drawing a
+     * model in its own space this way keeps it depth tested against the rest
+     * as long as camera is only moved and turned by quarter turns
+     */
+    uint32_t raycast;
+    union {
+        /**
+         * Pixel whose closest voxel pick_depth and pick_voxel read back, written
+         * as (y << 10) | (x << 1) like write_pixel. Keeps its value until written again
+         */
+        uint32_t pick_pixel;
+        /**
+         * Distance to the closest voxel rasterized at pick_pixel, in units of the
+         * pixel's look direction with FRACT_BITS fraction bits (read only).
+         * Only meaningful while pick_pixel is in the current chunk and pick_voxel hit
+         */
+        int32_t pick_depth;
+    };
+    /**
+     * Closest voxel rasterized at pick_pixel, with voxel type 0 if nothing was
+     * (read only). A brick reports the cell that was hit, a box its min corner
+     */
+    struct gpu_voxel pick_voxel;
+    /**
+     * Where write_pixel also writes the pixel's depth, laid out like the pixel
+     * buffer. The depth has GPU_DEPTH_FRACT_BITS fraction bits, and is INT16_MAX
+     * where nothing was drawn. Keeps its value until written again; NULL turns it off
+     */
+    int16_t *depth_buffer;
+    /**
+     * Where write_pixel also writes the pixel's pick_voxel, laid out like the
+     * pixel buffer but with a word per pixel. Keeps its value until written
+     * again; NULL turns it off
+     */
+    struct gpu_voxel *voxel_buffer;
     union {
         /**
          * Status of render (read only)
@@ -77,7 +170,7 @@ PA_STRUCT gpu_registers {
         uint32_t clear_error;
     };
     /**
-     * Position and orientation of the camera
+     * Position and orientation of the camera, with FRACT_BITS fraction bits
      */
     PA_STRUCT {
         struct _vec3 pos;
@@ -11,7 +11,17 @@ module pixel_shader #(
     input logic signed [COORD_BITS-1:0] voxel_x,
     input logic signed [COORD_BITS-1:0] voxel_y,
     input logic signed [COORD_BITS-1:0] voxel_z,
+    // box extents minus one, all zero for a unit voxel
+    input logic [COORD_BITS-1:0] voxel_size_x,
+    input logic [COORD_BITS-1:0] voxel_size_y,
+    input logic [COORD_BITS-1:0] voxel_size_z,
     input logic [PALETTE_BITS-1:0] voxel_id,
+    // 4x4x4 brick mode: the box is a brick whose set cells are
+    // bit (z * 16 + y * 4 + x) of brick_mask
+    input logic rasterize_brick,
+    input logic [63:0] brick_mask,
+    // cells are 2^brick_scale voxels wide; voxel_size must match
+    input logic [1:0] brick_scale,
     input logic [PIXEL_BITS-1:0] palette_entry,
     input logic signed [COORD_BITS+FRACT_BITS-1:0] cam_pos_x,
     input logic signed [COORD_BITS+FRACT_BITS-1:0] cam_pos_y,
@@ -24,6 +34,10 @@ module pixel_shader #(
     output logic shading_done,
     output logic error,
     output wire [PIXEL_BITS-1:0] pixel,
+    // distance to and coordinates of the closest voxel, for the same pixel as pixel;
+    // a brick hit reports the cell that was hit, and voxel ID 0 means nothing was hit
+    output wire signed [COORD_BITS+FRACT_BITS-1:0] pixel_depth,
+    output wire [COORD_BITS*3+PALETTE_BITS-1:0] pixel_voxel,
     input logic reset,
     input logic clock
 );
@@ -32,6 +46,8 @@ module pixel_shader #(
     ERROR,
     DIVIDE,
     MEASURE,
+    ENTER_BRICK,
+    MARCH_BRICK,
     STORE_VOXEL,
     DONE_RASTERIZING,
     STORE_PIXEL,
@@ -44,6 +60,8 @@ module pixel_shader #(
   assign pixel = (pixel_index == INDEX) ? _pixel : 'z;
 
   logic [PALETTE_BITS-1:0] closest_voxel;
+  logic signed [COORD_BITS-1:0] closest_x, closest_y, closest_z;
+  assign pixel_voxel = (pixel_index == INDEX) ? {closest_x, closest_y, closest_z, closest_voxel} : 'z;
 
   logic [7:0] cycle_counter;
 
@@ -57,9 +75,9 @@ module pixel_shader #(
   assign lx = {voxel_x, FRACT_BITS'(0)} - cam_pos_x;
   assign ly = {voxel_y, FRACT_BITS'(0)} - cam_pos_y;
   assign lz = {voxel_z, FRACT_BITS'(0)} - cam_pos_z;
-  assign hx = {voxel_x + 1'b1, FRACT_BITS'(0)} - cam_pos_x;
-  assign hy = {voxel_y + 1'b1, FRACT_BITS'(0)} - cam_pos_y;
-  assign hz = {voxel_z + 1'b1, FRACT_BITS'(0)} - cam_pos_z;
+  assign hx = {voxel_x + voxel_size_x + 1'b1, FRACT_BITS'(0)} - cam_pos_x;
+  assign hy = {voxel_y + voxel_size_y + 1'b1, FRACT_BITS'(0)} - cam_pos_y;
+  assign hz = {voxel_z + voxel_size_z + 1'b1, FRACT_BITS'(0)} - cam_pos_z;
 
   assign min_A_B_x = (tlx + s) < (thx + s) ? tlx : thx;
   assign min_A_B_y = (tly + s) < (thy + s) ? tly : thy;
@@ -69,6 +87,45 @@ module pixel_shader #(
   assign max_A_B_z = (tlz + s) > (thz + s) ? tlz : thz;
 
   assign t = (t_min + s) > s ? t_min : t_max;
+  assign pixel_depth = (pixel_index == INDEX) ? closest_t : 'z;
+
+  // brick marching: the cell boundaries along each axis are evenly spaced in t,
+  // so plane k of axis x is crossed at tlx + k * dtx
+  localparam MARCH_STEPS = 8'd10;  // most cells a ray can visit in a 4x4x4 brick
+  logic signed [COORD_BITS+FRACT_BITS:0] span_x, span_y, span_z;
+  logic signed [COORD_BITS+FRACT_BITS-1:0] dtx, dty, dtz, adtx, adty, adtz, t_start;
+  logic signed [COORD_BITS+FRACT_BITS-1:0] plane_x[0:4], plane_y[0:4], plane_z[0:4];
+  logic signed [COORD_BITS+FRACT_BITS-1:0] next_x, next_y, next_z, march_t;
+  logic [1:0] cell_x, cell_y, cell_z, crossed_x, crossed_y, crossed_z;
+  logic [0:2] steps;  // axes along which the ray moves between cells
+  logic march_done, brick_hit;
+  assign span_x = thx - tlx;
+  assign span_y = thy - tly;
+  assign span_z = thz - tlz;
+  assign dtx = span_x >>> 2;
+  assign dty = span_y >>> 2;
+  assign dtz = span_z >>> 2;
+  assign adtx = (dtx + s) < s ? -dtx : dtx;
+  assign adty = (dty + s) < s ? -dty : dty;
+  assign adtz = (dtz + s) < s ? -dtz : dtz;
+  assign t_start = (t_min + s) > s ? t_min : '0;
+  genvar k;
+  generate
+    for (k = 0; k <= 4; ++k) begin : planes
+      assign plane_x[k] = tlx + dtx * k;
+      assign plane_y[k] = tly + dty * k;
+      assign plane_z[k] = tlz + dtz * k;
+    end
+  endgenerate
+  // inner planes already behind the ray at t_start
+  assign crossed_x = ((plane_x[1] + s) <= (t_start + s)) + ((plane_x[2] + s) <= (t_start + s)) + ((plane_x[3] + s) <= (t_start + s));
+  assign crossed_y = ((plane_y[1] + s) <= (t_start + s)) + ((plane_y[2] + s) <= (t_start + s)) + ((plane_y[3] + s) <= (t_start + s));
+  assign crossed_z = ((plane_z[1] + s) <= (t_start + s)) + ((plane_z[2] + s) <= (t_start + s)) + ((plane_z[3] + s) <= (t_start + s));
+  assign steps = {
+    ~((dbz[0] | ovf[0]) | (dbz[3] | ovf[3])) && dtx != 0,
+    ~((dbz[1] | ovf[1]) | (dbz[4] | ovf[4])) && dty != 0,
+    ~((dbz[2] | ovf[2]) | (dbz[5] | ovf[5])) && dtz != 0
+  };
 
   logic div_start;
   logic [0:5] div_valid;
@@ -200,7 +257,17 @@ module pixel_shader #(
         else next_state = DIVIDE;
       end
       MEASURE: begin
-        next_state = STORE_VOXEL;
+        if (rasterize_brick) next_state = ENTER_BRICK;
+        else next_state = STORE_VOXEL;
+      end
+      ENTER_BRICK: begin
+        next_state = MARCH_BRICK;
+      end
+      MARCH_BRICK: begin
+        // always march for the same number of cycles, so that every
+        // shader finishes rasterizing together
+        if (cycle_counter < MARCH_STEPS - 8'd1) next_state = MARCH_BRICK;
+        else next_state = STORE_VOXEL;
       end
       STORE_VOXEL: begin
         next_state = DONE_RASTERIZING;
@@ -225,9 +292,21 @@ module pixel_shader #(
       cycle_counter <= '0;
       _pixel <= '0;
       closest_voxel <= '0;
+      closest_x <= '0;
+      closest_y <= '0;
+      closest_z <= '0;
       closest_t <= PINF;
       t_min <= PINF;
       t_max <= MINF;
+      cell_x <= '0;
+      cell_y <= '0;
+      cell_z <= '0;
+      next_x <= PINF;
+      next_y <= PINF;
+      next_z <= PINF;
+      march_t <= PINF;
+      march_done <= 1'b1;
+      brick_hit <= 1'b0;
     end else begin
       case (state)
         IDLE: begin
@@ -286,10 +365,74 @@ module pixel_shader #(
             t_max <= (t_max + s) < (max_A_B_z + s) ? t_max : max_A_B_z;
           end
         end
+        ENTER_BRICK: begin
+          // start in the cell holding the entry point (or the camera, if inside the brick);
+          // an axis the ray doesn't step along stays in the cell holding the camera
+          cycle_counter <= '0;
+          march_t <= t_start;
+          march_done <= !((t_min + s) <= (t_max + s) && (t_max + s) > s);
+          brick_hit <= 1'b0;
+          if (steps[0]) begin
+            cell_x <= (dtx + s) > s ? crossed_x : 2'd3 - crossed_x;
+            next_x <= (dtx + s) > s ? plane_x[crossed_x + 3'd1] : plane_x[2'd3 - crossed_x];
+          end else begin
+            cell_x <= 2'(-lx >>> (FRACT_BITS + brick_scale));
+            next_x <= PINF;
+          end
+          if (steps[1]) begin
+            cell_y <= (dty + s) > s ? crossed_y : 2'd3 - crossed_y;
+            next_y <= (dty + s) > s ? plane_y[crossed_y + 3'd1] : plane_y[2'd3 - crossed_y];
+          end else begin
+            cell_y <= 2'(-ly >>> (FRACT_BITS + brick_scale));
+            next_y <= PINF;
+          end
+          if (steps[2]) begin
+            cell_z <= (dtz + s) > s ? crossed_z : 2'd3 - crossed_z;
+            next_z <= (dtz + s) > s ? plane_z[crossed_z + 3'd1] : plane_z[2'd3 - crossed_z];
+          end else begin
+            cell_z <= 2'(-lz >>> (FRACT_BITS + brick_scale));
+            next_z <= PINF;
+          end
+        end
+        MARCH_BRICK: begin
+          cycle_counter <= cycle_counter + 8'd1;
+          if (!march_done) begin
+            if (brick_mask[{cell_z, cell_y, cell_x}] && (march_t + s) > s) begin  // intersection!
+              brick_hit <= 1'b1;
+              march_done <= 1'b1;
+            end else if ((next_x + s) <= (next_y + s) && (next_x + s) <= (next_z + s)) begin
+              march_t <= next_x;
+              next_x <= next_x + adtx;
+              if (!steps[0] || cell_x == ((dtx + s) > s ? 2'd3 : 2'd0)) march_done <= 1'b1;
+              else cell_x <= (dtx + s) > s ? cell_x + 2'd1 : cell_x - 2'd1;
+            end else if ((next_y + s) <= (next_z + s)) begin
+              march_t <= next_y;
+              next_y <= next_y + adty;
+              if (!steps[1] || cell_y == ((dty + s) > s ? 2'd3 : 2'd0)) march_done <= 1'b1;
+              else cell_y <= (dty + s) > s ? cell_y + 2'd1 : cell_y - 2'd1;
+            end else begin
+              march_t <= next_z;
+              next_z <= next_z + adtz;
+              if (!steps[2] || cell_z == ((dtz + s) > s ? 2'd3 : 2'd0)) march_done <= 1'b1;
+              else cell_z <= (dtz + s) > s ? cell_z + 2'd1 : cell_z - 2'd1;
+            end
+          end
+        end
         STORE_VOXEL: begin
-          if ((t + s) > s && (t_min + s) <= (t_max + s) && (t + s) < (closest_t + s)) begin  // intersection!
+          if (rasterize_brick) begin
+            if (brick_hit && (march_t + s) < (closest_t + s)) begin
+              closest_t <= march_t;
+              closest_voxel <= voxel_id;
+              closest_x <= voxel_x + (COORD_BITS'(cell_x) << brick_scale);
+              closest_y <= voxel_y + (COORD_BITS'(cell_y) << brick_scale);
+              closest_z <= voxel_z + (COORD_BITS'(cell_z) << brick_scale);
+            end
+          end else if ((t + s) > s && (t_min + s) <= (t_max + s) && (t + s) < (closest_t + s)) begin  // intersection!
             closest_t <= t;
             closest_voxel <= voxel_id;
+            closest_x <= voxel_x;
+            closest_y <= voxel_y;
+            closest_z <= voxel_z;
           end
         end
         STORE_PIXEL: begin
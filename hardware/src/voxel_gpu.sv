@@ -37,11 +37,45 @@ module voxel_gpu #(
 
   // GPU.*
   logic [31:0] rasterize_voxel, shade_entry, write_pixel, start_pixel;
+  // size of the box drawn by rasterize_voxel, laid out like a voxel
+  logic [31:0] voxel_extent;
+  // occupancy of the 4x4x4 brick drawn by rasterize_brick
+  logic [63:0] brick_mask;
+  logic rasterize_brick;
+  // min corner of the 16x16x16 brick that compact voxel packets are relative to
+  logic [31:0] packet_origin;
+  // second packet of the last packet pair, drawn once the first is done
+  logic [15:0] pending_packet;
+  // pixel whose closest voxel is read back, in the X-Y addressing of write_pixel
+  logic [31:0] pick_pixel;
+  // where write-out also puts each pixel's depth and closest voxel, laid out
+  // like the pixel buffer with 16 and 32 bits a pixel; 0 leaves them out
+  logic [31:0] depth_buffer, voxel_buffer;
   // GPU.camera
   camera cam;
 
   // local variables
   logic [31:0] cycle_counter;
+  // which word of the pixel write-out is on m1
+  enum logic [1:0] {
+    WRITE_COLOR,
+    WRITE_DEPTH,
+    WRITE_VOXEL_LOW,
+    WRITE_VOXEL_HIGH
+  } write_step;
+
+  // a compact packet is laid out like a voxel with 4-bit coordinates,
+  // which are offsets from origin, and 2 unused bits below them
+  function automatic logic [31:0] unpack_voxel(input logic [31:0] origin, input logic [15:0] packet);
+    logic signed [COORD_BITS-1:0] x, y, z;
+    {x, y, z} = origin[31-:COORD_BITS*3];
+    return {
+      x + COORD_BITS'(packet[15:12]),
+      y + COORD_BITS'(packet[11:8]),
+      z + COORD_BITS'(packet[7:4]),
+      packet[0+:VOXEL_BITS]
+    };
+  endfunction
 
   // shader variables
   localparam ROW_BITS = $clog2(V_RESOLUTION);
@@ -49,11 +83,25 @@ module voxel_gpu #(
   logic signed [COORD_BITS-1:0] voxel_x, voxel_y, voxel_z;
   logic [(32-COORD_BITS*3)-1:0] voxel_id;
   assign {voxel_x, voxel_y, voxel_z, voxel_id} = (state == SHADE ? shade_entry : rasterize_voxel);
+  // bricks take their cell size, 2^brick_scale, from the low bits of voxel_extent
+  logic [1:0] brick_scale;
+  assign brick_scale = voxel_extent[1:0];
+  logic [COORD_BITS-1:0] voxel_size_x, voxel_size_y, voxel_size_z;
+  assign {voxel_size_x, voxel_size_y, voxel_size_z} =
+      rasterize_brick ? {3{(COORD_BITS'(4) << brick_scale) - 1'b1}} : voxel_extent[31-:COORD_BITS*3];
   logic [PIXEL_BITS-1:0] palette_entry;
   assign palette_entry = shade_entry[31-:PIXEL_BITS];
+  // the shaders put the pixel being written out on their outputs, and the picked one otherwise
+  logic [31:0] selected_pixel;
+  assign selected_pixel = (state == WRITE_OUT) ? write_pixel : pick_pixel;
   logic [ROW_BITS+COL_BITS-1:0] pixel_index;
-  assign pixel_index = write_pixel[(COL_BITS + 1) +: ROW_BITS] * H_RESOLUTION + write_pixel[1 +: COL_BITS] - start_pixel;
+  assign pixel_index = selected_pixel[(COL_BITS + 1) +: ROW_BITS] * H_RESOLUTION + selected_pixel[1 +: COL_BITS] - start_pixel;
   wire [PIXEL_BITS-1:0] pixel;
+  wire signed [COORD_BITS+FRACT_BITS-1:0] pixel_depth;
+  wire [31:0] pixel_voxel;
+  // offset of the written pixel in a buffer of 16-bit pixels
+  logic [31:0] pixel_offset;
+  assign pixel_offset = 32'(write_pixel[0 +: ROW_BITS + COL_BITS + 1]);
   logic raycast_start, coordinate_start, do_rasterize, do_shade;
   logic [0:NUM_SHADERS-1] raycast_valid, coordinate_valid, rasterizing_done, shading_done;
   logic [0:NUM_SHADERS] error;
@@ -216,14 +264,25 @@ module voxel_gpu #(
       shade_entry <= '0;
       write_pixel <= '0;
       start_pixel <= '0;
+      voxel_extent <= '0;
+      brick_mask <= '0;
+      rasterize_brick <= 1'b0;
+      packet_origin <= '0;
+      pending_packet <= '0;
+      pick_pixel <= '0;
+      depth_buffer <= '0;
+      voxel_buffer <= '0;
       cam <= '{default: 0};
       cycle_counter <= 0;
+      write_step <= WRITE_COLOR;
     end else begin
       if (s1_write) begin
         case (s1_address)
           8'h00: begin
             if (ready) begin
               rasterize_voxel <= s1_writedata;
+              rasterize_brick <= 1'b0;
+              pending_packet <= '0;
               state <= RASTERIZE;
             end else begin
               state <= ERROR;
@@ -253,6 +312,56 @@ module voxel_gpu #(
               state <= ERROR;
             end
           end
+          8'h04: begin
+            voxel_extent <= s1_writedata;
+          end
+          8'h05: begin
+            brick_mask[31:0] <= s1_writedata;
+          end
+          8'h06: begin
+            brick_mask[63:32] <= s1_writedata;
+          end
+          8'h07: begin
+            if (ready) begin
+              rasterize_voxel <= s1_writedata;
+              rasterize_brick <= 1'b1;
+              pending_packet <= '0;
+              state <= RASTERIZE;
+            end else begin
+              state <= ERROR;
+            end
+          end
+          8'h08: begin
+            packet_origin <= s1_writedata;
+          end
+          8'h09: begin
+            if (ready) begin
+              rasterize_voxel <= unpack_voxel(packet_origin, s1_writedata[15:0]);
+              rasterize_brick <= 1'b0;
+              pending_packet <= s1_writedata[31:16];
+              state <= RASTERIZE;
+            end else begin
+              state <= ERROR;
+            end
+          end
+          8'h0a: begin
+            // recompute the rays of the chunk from the current camera,
+            // keeping the closest voxel found so far for every pixel
+            if (ready) begin
+              state <= RAYCAST;
+            end else begin
+              state <= ERROR;
+            end
+          end
+          8'h0b: begin
+            pick_pixel <= s1_writedata;
+          end
+          8'h0d: begin
+            depth_buffer <= s1_writedata;
+          end
+          8'h0e: begin
+            voxel_buffer <= s1_writedata;
+          end
           8'h0f: begin
             if (state == ERROR && s1_writedata) begin
               state <= IDLE;
@@ -325,13 +434,33 @@ module voxel_gpu #(
           else if (&raycast_valid) state <= IDLE;
         end
         RASTERIZE: begin
-          if (&rasterizing_done) state <= IDLE;
+          if (&rasterizing_done) begin
+            // a second packet with voxel type 0 is padding, not a voxel
+            if (pending_packet[0+:VOXEL_BITS] != '0) begin
+              rasterize_voxel <= unpack_voxel(packet_origin, pending_packet);
+              pending_packet <= '0;
+              cycle_counter <= 0;
+            end else begin
+              state <= IDLE;
+            end
+          end
         end
         SHADE: begin
           if (&shading_done) state <= IDLE;
         end
         WRITE_OUT: begin
-          if (!m1_waitrequest) state <= IDLE;
+          if (!m1_waitrequest) begin
+            if (write_step == WRITE_COLOR && depth_buffer != '0) begin
+              write_step <= WRITE_DEPTH;
+            end else if ((write_step == WRITE_COLOR || write_step == WRITE_DEPTH) && voxel_buffer != '0) begin
+              write_step <= WRITE_VOXEL_LOW;
+            end else if (write_step == WRITE_VOXEL_LOW) begin
+              write_step <= WRITE_VOXEL_HIGH;
+            end else begin
+              write_step <= WRITE_COLOR;
+              state <= IDLE;
+            end
+          end
         end
         ERROR: begin
           cycle_counter <= 0;
@@ -362,9 +491,26 @@ module voxel_gpu #(
         do_shade = cycle_counter < 2;
       end
       WRITE_OUT: begin
-        m1_address = write_pixel;
         m1_write = 1'b1;
-        m1_writedata = pixel;
+        case (write_step)
+          WRITE_COLOR: begin
+            m1_address = write_pixel;
+            m1_writedata = pixel;
+          end
+          WRITE_DEPTH: begin
+            // the top 16 bits of the depth, so misses still read as the largest depth
+            m1_address = depth_buffer + pixel_offset;
+            m1_writedata = 16'(pixel_depth >>> (COORD_BITS + FRACT_BITS - 16));
+          end
+          WRITE_VOXEL_LOW: begin
+            m1_address = voxel_buffer + (pixel_offset << 1);
+            m1_writedata = pixel_voxel[15:0];
+          end
+          WRITE_VOXEL_HIGH: begin
+            m1_address = voxel_buffer + (pixel_offset << 1) + 32'd2;
+            m1_writedata = pixel_voxel[31:16];
+          end
+        endcase
       end
     endcase
   end
@@ -372,6 +518,31 @@ module voxel_gpu #(
   always_comb begin
     s1_readdata = '0;
     case (s1_address)
+      8'h04: begin
+        s1_readdata = voxel_extent;
+      end
+      8'h05: begin
+        s1_readdata = brick_mask[31:0];
+      end
+      8'h06: begin
+        s1_readdata = brick_mask[63:32];
+      end
+      8'h08: begin
+        s1_readdata = packet_origin;
+      end
+      8'h0b: begin
+        // pick_pixel outside the chunk selects no shader, and reads as a miss
+        s1_readdata = (pixel_index < NUM_SHADERS) ? 32'(pixel_depth) : 32'((1 << (COORD_BITS + FRACT_BITS - 1)) - 1);
+      end
+      8'h0c: begin
+        s1_readdata = (pixel_index < NUM_SHADERS) ? pixel_voxel : 32'b0;
+      end
+      8'h0d: begin
+        s1_readdata = depth_buffer;
+      end
+      8'h0e: begin
+        s1_readdata = voxel_buffer;
+      end
       8'h0f: begin
         s1_readdata = ready ? 0 : (state == ERROR ? 2 : 1);
       end
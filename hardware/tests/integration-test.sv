@@ -193,6 +193,75 @@ module testbench #(
     end
   endtask
 
+  // the scene, one voxel per write
+  task draw_voxels();
+    begin
+      write_s1(0, {10'd0, 10'd0, 10'd0, 2'd1});
+      @(posedge DUT.ready);
+      write_s1(0, {10'(-1), 10'd2, 10'd2, 2'd1});
+      @(posedge DUT.ready);
+      write_s1(0, {10'(-1), 10'd2, 10'(-2), 2'd1});
+      @(posedge DUT.ready);
+      write_s1(0, {10'(-1), 10'(-2), 10'd2, 2'd1});
+      @(posedge DUT.ready);
+      write_s1(0, {10'(-1), 10'(-2), 10'(-2), 2'd1});
+      @(posedge DUT.ready);
+
+      write_s1(0, {10'd1, 10'd2, 10'd2, 2'd1});
+      @(posedge DUT.ready);
+      write_s1(0, {10'd1, 10'd2, 10'(-2), 2'd1});
+      @(posedge DUT.ready);
+      write_s1(0, {10'd1, 10'(-2), 10'd2, 2'd1});
+      @(posedge DUT.ready);
+      write_s1(0, {10'd1, 10'(-2), 10'(-2), 2'd1});
+      @(posedge DUT.ready);
+    end
+  endtask
+
+  // the same scene as compact packets, two per write, relative to (-1, -2, -2);
+  // each packet is {x, y, z, 2'b0, voxel type} with 4-bit offsets
+  task draw_packets();
+    begin
+      write_s1(8, {10'(-1), 10'(-2), 10'(-2), 2'd0});
+      write_s1(9, {16'h0441, 16'h1221});
+      @(posedge DUT.ready);
+      write_s1(9, {16'h0041, 16'h0401});
+      @(posedge DUT.ready);
+      write_s1(9, {16'h2441, 16'h0001});
+      @(posedge DUT.ready);
+      write_s1(9, {16'h2041, 16'h2401});
+      @(posedge DUT.ready);
+      // a second packet of voxel type 0 is padding
+      write_s1(9, {16'h0000, 16'h2001});
+      @(posedge DUT.ready);
+    end
+  endtask
+
+  // 16-bit word of OCRAM at a bus address
+  function automatic logic [15:0] ocram_half(input logic [31:0] addr);
+    return addr[1] ? ocram.mem[addr[17:2]][31:16] : ocram.mem[addr[17:2]][15:0];
+  endfunction
+
+  int failures = 0;
+  task check(input string name, input logic passed);
+    begin
+      if (!passed) begin
+        $error("%s: FAILED", name);
+        failures++;
+      end
+    end
+  endtask
+
+  // the chunk read back through the pick registers and write-out: the left half
+  // of a row through the scene, with its depth and voxel buffers placed so the
+  // chunk's entries land past the end of the frame in OCRAM
+  localparam PICK_ROW = 144;
+  localparam DEPTH_BASE = OCRAM_BASE + 'h3c000 - (PICK_ROW << 10);
+  localparam VOXEL_BASE = OCRAM_BASE + 'h3d000 - (PICK_ROW << 11);
+  logic [31:0] pick_depth[], pick_voxel[];
+  logic [31:0] depth, voxel, pixel;
+  int hits;
+
   int row, col, i, j;
   initial begin
     // default values for inputs
@@ -251,26 +320,7 @@ module testbench #(
       write_s1(3, i);
       @(posedge DUT.ready);
 
-      write_s1(0, {10'd0, 10'd0, 10'd0, 2'd1});
-      @(posedge DUT.ready);
-      write_s1(0, {10'(-1), 10'd2, 10'd2, 2'd1});
-      @(posedge DUT.ready);
-      write_s1(0, {10'(-1), 10'd2, 10'(-2), 2'd1});
-      @(posedge DUT.ready);
-      write_s1(0, {10'(-1), 10'(-2), 10'd2, 2'd1});
-      @(posedge DUT.ready);
-      write_s1(0, {10'(-1), 10'(-2), 10'(-2), 2'd1});
-      @(posedge DUT.ready);
-
-      write_s1(0, {10'd1, 10'd2, 10'd2, 2'd1});
-      @(posedge DUT.ready);
-      write_s1(0, {10'd1, 10'd2, 10'(-2), 2'd1});
-      @(posedge DUT.ready);
-      write_s1(0, {10'd1, 10'(-2), 10'd2, 2'd1});
-      @(posedge DUT.ready);
-      write_s1(0, {10'd1, 10'(-2), 10'(-2), 2'd1});
-      @(posedge DUT.ready);
-
+      draw_voxels();
 
       write_s1(1, {16'h001F, 14'd0, 2'd1});
       @(posedge DUT.ready);
@@ -285,6 +335,53 @@ module testbench #(
 
     $writememh("ocram.hex", ocram.mem);
     $system("./ocram_to_bmp.py");
+
+    // pick registers: the closest voxel under each pixel of the chunk
+    pick_depth = new[DUT.NUM_SHADERS];
+    pick_voxel = new[DUT.NUM_SHADERS];
+    hits = 0;
+    write_s1(3, PICK_ROW * DUT.H_RESOLUTION);
+    @(posedge DUT.ready);
+    draw_voxels();
+    for (j = 0; j < DUT.NUM_SHADERS; ++j) begin
+      write_s1(8'h0b, OCRAM_BASE + {8'(PICK_ROW), 9'(j), 1'b0});
+      read_s1(8'h0b, pick_depth[j]);
+      read_s1(8'h0c, pick_voxel[j]);
+      if (pick_voxel[j][1:0] != 2'd0) hits++;
+    end
+    check("pick hits", hits > 0 && hits < DUT.NUM_SHADERS);
+    // a pixel outside the chunk reads as a miss
+    write_s1(8'h0b, OCRAM_BASE + {8'(PICK_ROW + 1), 9'd0, 1'b0});
+    read_s1(8'h0b, depth);
+    read_s1(8'h0c, voxel);
+    check("pick outside chunk", depth == (1 << (DUT.COORD_BITS + DUT.FRACT_BITS - 1)) - 1 && voxel == 0);
+
+    // packet pairs must draw the same chunk, and write-out must store the
+    // depth and voxel of every pixel next to its color
+    write_s1(8'h0d, DEPTH_BASE);
+    write_s1(8'h0e, VOXEL_BASE);
+    write_s1(3, PICK_ROW * DUT.H_RESOLUTION);
+    @(posedge DUT.ready);
+    draw_packets();
+    write_s1(1, {16'h001F, 14'd0, 2'd1});
+    @(posedge DUT.ready);
+    for (j = 0; j < DUT.NUM_SHADERS; ++j) begin
+      pixel = {8'(PICK_ROW), 9'(j), 1'b0};
+      write_s1(2, OCRAM_BASE + pixel);
+      @(posedge DUT.ready);
+      write_s1(8'h0b, OCRAM_BASE + pixel);
+      read_s1(8'h0b, depth);
+      read_s1(8'h0c, voxel);
+      check($sformatf("packet pair pixel %0d", j), depth == pick_depth[j] && voxel == pick_voxel[j]);
+      check($sformatf("depth write-out pixel %0d", j),
+            ocram_half(DEPTH_BASE + pixel) == 16'(signed'(depth) >>> (DUT.COORD_BITS + DUT.FRACT_BITS - 16)));
+      check($sformatf("voxel write-out pixel %0d", j),
+            {ocram_half(VOXEL_BASE + (pixel << 1) + 2), ocram_half(VOXEL_BASE + (pixel << 1))} == voxel);
+    end
+    write_s1(8'h0d, 0);
+    write_s1(8'h0e, 0);
+
+    $display("%0d hits in the picked chunk, %0d failures", hits, failures);
     $stop;
   end
 endmodule
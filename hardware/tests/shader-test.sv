@@ -14,7 +14,13 @@ module testbench #(
   logic [COORD_BITS-1:0] voxel_x;
   logic [COORD_BITS-1:0] voxel_y;
   logic [COORD_BITS-1:0] voxel_z;
+  logic [COORD_BITS-1:0] voxel_size_x;
+  logic [COORD_BITS-1:0] voxel_size_y;
+  logic [COORD_BITS-1:0] voxel_size_z;
   logic [PALETTE_BITS-1:0] voxel_id;
+  logic rasterize_brick;
+  logic [63:0] brick_mask;
+  logic [1:0] brick_scale;
   logic [PIXEL_BITS-1:0] palette_entry;
   logic signed [COORD_BITS+FRACT_BITS-1:0] cam_pos_x;
   logic signed [COORD_BITS+FRACT_BITS-1:0] cam_pos_y;
@@ -25,11 +31,56 @@ module testbench #(
   logic [INDEX_BITS-1:0] pixel_index;
   logic rasterizing_done;
   logic shading_done;
+  logic error;
   wire [PIXEL_BITS-1:0] pixel;
+  wire signed [COORD_BITS+FRACT_BITS-1:0] pixel_depth;
+  wire [COORD_BITS*3+PALETTE_BITS-1:0] pixel_voxel;
   logic reset;
   logic clock;
 
-  pixel_shader #() DUT (.*);
+  pixel_shader #(
+      .INDEX_BITS(INDEX_BITS),
+      .COORD_BITS(COORD_BITS),
+      .PALETTE_BITS(PALETTE_BITS),
+      .FRACT_BITS(FRACT_BITS),
+      .PIXEL_BITS(PIXEL_BITS)
+  ) DUT (.*);
+
+  int failures = 0;
+  task check(input string name, input logic passed);
+    begin
+      if (passed) begin
+        $display("%s: passed", name);
+      end else begin
+        $error("%s: FAILED (depth %h, voxel %h)", name, pixel_depth, pixel_voxel);
+        failures++;
+      end
+    end
+  endtask
+
+  // clears the closest voxel, as voxel_gpu does at the start of each chunk
+  task clear_closest();
+    begin
+      do_rasterize = 1'b0;
+      reset = 1'b1;
+      @(negedge clock);
+      reset = 1'b0;
+    end
+  endtask
+
+  task rasterize(input logic [COORD_BITS-1:0] x, input logic [COORD_BITS-1:0] y,
+                 input logic [COORD_BITS-1:0] z, input logic [PALETTE_BITS-1:0] id);
+    begin
+      voxel_x = x;
+      voxel_y = y;
+      voxel_z = z;
+      voxel_id = id;
+      do_rasterize = 1'b1;
+      @(posedge rasterizing_done);
+      @(posedge clock);
+      do_rasterize = 1'b0;
+    end
+  endtask
 
   // set up clock
   initial begin
@@ -52,6 +103,12 @@ module testbench #(
     cam_look_y = {8'(-1), 8'd0};
     cam_look_z = {8'(-1), 8'd0};
     pixel_index = 32'b0;
+    voxel_size_x = '0;
+    voxel_size_y = '0;
+    voxel_size_z = '0;
+    rasterize_brick = 1'b0;
+    brick_mask = '0;
+    brick_scale = '0;
 
     @(negedge clock);
     reset = 1'b0;
@@ -81,6 +138,8 @@ module testbench #(
     @(posedge rasterizing_done);
     @(posedge clock);
     do_rasterize = 1'b0;
+    // the ray from (4, 4, 4) along (-1, -1, -1) reaches (2, 2, 2) at t = 1
+    check("closest voxel", pixel_voxel == {8'd2, 8'd2, 8'd2, 8'd2} && pixel_depth == {8'd1, 8'd0});
 
     // shade first voxel
     voxel_id = 8'd1;
@@ -97,7 +156,48 @@ module testbench #(
     // one more cycle for good measure
     do_shade = 1'b0;
     @(posedge clock);
+    check("shaded pixel", pixel == 8'h22);
+
+    // only the shader selected by pixel_index drives its outputs
+    pixel_index = 32'd1;
+    #1;
+    check("unselected shader", pixel_voxel === 'z && pixel_depth === 'z && pixel === 'z);
+    pixel_index = 32'b0;
+
+    // boxes: a 2x2x2 box at the origin is reached at t = 2, before the
+    // unit voxel at the origin (t = 3); a box behind the camera is never hit
+    clear_closest();
+    rasterize(8'd0, 8'd0, 8'd0, 8'd1);
+    voxel_size_x = 8'd1;
+    voxel_size_y = 8'd1;
+    voxel_size_z = 8'd1;
+    rasterize(8'd0, 8'd0, 8'd0, 8'd3);
+    voxel_size_x = 8'd0;
+    voxel_size_y = 8'd2;
+    voxel_size_z = 8'd2;
+    rasterize(8'd5, 8'd0, 8'd0, 8'd4);
+    check("box", pixel_voxel == {8'd0, 8'd0, 8'd0, 8'd3} && pixel_depth == {8'd2, 8'd0});
+
+    // bricks: a 4x4x4 brick at the origin, with the camera on its far corner.
+    // The ray walks the cells (3, 3, 3), (2, 3, 3), (2, 2, 3), (2, 2, 2), ... (0, 0, 0).
+    // The high planes divide to 0, which div leaves as its reset value, so clear first
+    clear_closest();
+    rasterize_brick = 1'b1;
+    brick_scale = 2'd0;
+    voxel_size_x = 8'd3;
+    voxel_size_y = 8'd3;
+    voxel_size_z = 8'd3;
+    // cell (3, 0, 0) is off the ray, and (3, 3, 3) holds the camera, so neither is hit
+    brick_mask = (64'b1 << 3) | (64'b1 << 63);
+    rasterize(8'd0, 8'd0, 8'd0, 8'd5);
+    check("brick miss", pixel_voxel[PALETTE_BITS-1:0] == 8'd0 && pixel_depth == 16'h7fff);
+    // cell (1, 1, 1) is entered at t = 2, and reported instead of the brick's corner
+    brick_mask = 64'b1 << (1 * 16 + 1 * 4 + 1);
+    rasterize(8'd0, 8'd0, 8'd0, 8'd6);
+    check("brick march", pixel_voxel == {8'd1, 8'd1, 8'd1, 8'd6} && pixel_depth == {8'd2, 8'd0});
+    rasterize_brick = 1'b0;
 
+    $display("%0d failures", failures);
     $stop;
   end
 endmodule
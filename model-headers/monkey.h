@@ -3,1767 +3,1771 @@
 
 #include "firmware/firmware.h"
 
+static const struct gpu_voxel monkey_voxels[] = {
+    { .x = 113, .y = 124, .z = 116, .voxel_id = 1 },
+    { .x = 113, .y = 125, .z = 116, .voxel_id = 1 },
+    { .x = 113, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 113, .y = 127, .z = 116, .voxel_id = 1 },
+    { .x = 113, .y = 128, .z = 116, .voxel_id = 1 },
+    { .x = 113, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 113, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 113, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 113, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 113, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 114, .y = 124, .z = 116, .voxel_id = 1 },
+    { .x = 114, .y = 125, .z = 116, .voxel_id = 1 },
+    { .x = 114, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 114, .y = 127, .z = 116, .voxel_id = 1 },
+    { .x = 114, .y = 128, .z = 116, .voxel_id = 1 },
+    { .x = 114, .y = 129, .z = 116, .voxel_id = 1 },
+    { .x = 114, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 114, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 114, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 114, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 114, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 114, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 114, .y = 129, .z = 117, .voxel_id = 1 },
+    { .x = 114, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 114, .y = 124, .z = 118, .voxel_id = 1 },
+    { .x = 114, .y = 128, .z = 118, .voxel_id = 1 },
+    { .x = 115, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 115, .y = 127, .z = 116, .voxel_id = 1 },
+    { .x = 115, .y = 128, .z = 116, .voxel_id = 1 },
+    { .x = 115, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 115, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 115, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 115, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 115, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 115, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 115, .y = 129, .z = 117, .voxel_id = 1 },
+    { .x = 115, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 115, .y = 124, .z = 118, .voxel_id = 1 },
+    { .x = 115, .y = 126, .z = 118, .voxel_id = 1 },
+    { .x = 115, .y = 127, .z = 118, .voxel_id = 1 },
+    { .x = 115, .y = 128, .z = 118, .voxel_id = 1 },
+    { .x = 115, .y = 129, .z = 118, .voxel_id = 1 },
+    { .x = 116, .y = 122, .z = 116, .voxel_id = 1 },
+    { .x = 116, .y = 123, .z = 116, .voxel_id = 1 },
+    { .x = 116, .y = 124, .z = 116, .voxel_id = 1 },
+    { .x = 116, .y = 125, .z = 116, .voxel_id = 1 },
+    { .x = 116, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 116, .y = 127, .z = 116, .voxel_id = 1 },
+    { .x = 116, .y = 128, .z = 116, .voxel_id = 1 },
+    { .x = 116, .y = 122, .z = 117, .voxel_id = 1 },
+    { .x = 116, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 116, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 116, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 116, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 116, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 116, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 116, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 116, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 116, .y = 124, .z = 118, .voxel_id = 1 },
+    { .x = 116, .y = 125, .z = 118, .voxel_id = 1 },
+    { .x = 116, .y = 126, .z = 118, .voxel_id = 1 },
+    { .x = 116, .y = 127, .z = 118, .voxel_id = 1 },
+    { .x = 116, .y = 128, .z = 118, .voxel_id = 1 },
+    { .x = 116, .y = 129, .z = 118, .voxel_id = 1 },
+    { .x = 116, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 116, .y = 123, .z = 119, .voxel_id = 1 },
+    { .x = 116, .y = 128, .z = 119, .voxel_id = 1 },
+    { .x = 117, .y = 122, .z = 117, .voxel_id = 1 },
+    { .x = 117, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 117, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 117, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 117, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 117, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 117, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 117, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 117, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 117, .y = 124, .z = 118, .voxel_id = 1 },
+    { .x = 117, .y = 125, .z = 118, .voxel_id = 1 },
+    { .x = 117, .y = 126, .z = 118, .voxel_id = 1 },
+    { .x = 117, .y = 127, .z = 118, .voxel_id = 1 },
+    { .x = 117, .y = 128, .z = 118, .voxel_id = 1 },
+    { .x = 117, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 117, .y = 123, .z = 119, .voxel_id = 1 },
+    { .x = 117, .y = 124, .z = 119, .voxel_id = 1 },
+    { .x = 117, .y = 126, .z = 119, .voxel_id = 1 },
+    { .x = 117, .y = 127, .z = 119, .voxel_id = 1 },
+    { .x = 117, .y = 128, .z = 119, .voxel_id = 1 },
+    { .x = 117, .y = 122, .z = 120, .voxel_id = 1 },
+    { .x = 117, .y = 123, .z = 120, .voxel_id = 1 },
+    { .x = 118, .y = 122, .z = 117, .voxel_id = 1 },
+    { .x = 118, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 118, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 118, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 118, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 118, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 118, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 118, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 118, .y = 124, .z = 118, .voxel_id = 1 },
+    { .x = 118, .y = 125, .z = 118, .voxel_id = 1 },
+    { .x = 118, .y = 126, .z = 118, .voxel_id = 1 },
+    { .x = 118, .y = 127, .z = 118, .voxel_id = 1 },
+    { .x = 118, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 118, .y = 123, .z = 119, .voxel_id = 1 },
+    { .x = 118, .y = 124, .z = 119, .voxel_id = 1 },
+    { .x = 118, .y = 125, .z = 119, .voxel_id = 1 },
+    { .x = 118, .y = 126, .z = 119, .voxel_id = 1 },
+    { .x = 118, .y = 127, .z = 119, .voxel_id = 1 },
+    { .x = 118, .y = 128, .z = 119, .voxel_id = 1 },
+    { .x = 118, .y = 122, .z = 120, .voxel_id = 1 },
+    { .x = 118, .y = 123, .z = 120, .voxel_id = 1 },
+    { .x = 118, .y = 126, .z = 120, .voxel_id = 1 },
+    { .x = 118, .y = 127, .z = 120, .voxel_id = 1 },
+    { .x = 118, .y = 128, .z = 120, .voxel_id = 1 },
+    { .x = 118, .y = 126, .z = 121, .voxel_id = 1 },
+    { .x = 118, .y = 127, .z = 121, .voxel_id = 1 },
+    { .x = 118, .y = 128, .z = 121, .voxel_id = 1 },
+    { .x = 118, .y = 129, .z = 121, .voxel_id = 1 },
+    { .x = 118, .y = 125, .z = 122, .voxel_id = 1 },
+    { .x = 118, .y = 126, .z = 122, .voxel_id = 1 },
+    { .x = 118, .y = 127, .z = 122, .voxel_id = 1 },
+    { .x = 118, .y = 128, .z = 122, .voxel_id = 1 },
+    { .x = 118, .y = 126, .z = 123, .voxel_id = 1 },
+    { .x = 118, .y = 127, .z = 123, .voxel_id = 1 },
+    { .x = 118, .y = 128, .z = 123, .voxel_id = 1 },
+    { .x = 118, .y = 126, .z = 124, .voxel_id = 1 },
+    { .x = 118, .y = 127, .z = 124, .voxel_id = 1 },
+    { .x = 118, .y = 126, .z = 125, .voxel_id = 1 },
+    { .x = 118, .y = 127, .z = 125, .voxel_id = 1 },
+    { .x = 118, .y = 125, .z = 127, .voxel_id = 1 },
+    { .x = 118, .y = 126, .z = 127, .voxel_id = 1 },
+    { .x = 118, .y = 127, .z = 127, .voxel_id = 1 },
+    { .x = 118, .y = 128, .z = 127, .voxel_id = 1 },
+    { .x = 118, .y = 126, .z = 128, .voxel_id = 1 },
+    { .x = 118, .y = 127, .z = 128, .voxel_id = 1 },
+    { .x = 118, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 118, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 119, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 119, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 119, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 119, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 119, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 119, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 119, .y = 124, .z = 118, .voxel_id = 1 },
+    { .x = 119, .y = 125, .z = 118, .voxel_id = 1 },
+    { .x = 119, .y = 126, .z = 118, .voxel_id = 1 },
+    { .x = 119, .y = 127, .z = 118, .voxel_id = 1 },
+    { .x = 119, .y = 128, .z = 118, .voxel_id = 1 },
+    { .x = 119, .y = 129, .z = 118, .voxel_id = 1 },
+    { .x = 119, .y = 130, .z = 118, .voxel_id = 1 },
+    { .x = 119, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 119, .y = 123, .z = 119, .voxel_id = 1 },
+    { .x = 119, .y = 124, .z = 119, .voxel_id = 1 },
+    { .x = 119, .y = 125, .z = 119, .voxel_id = 1 },
+    { .x = 119, .y = 126, .z = 119, .voxel_id = 1 },
+    { .x = 119, .y = 127, .z = 119, .voxel_id = 1 },
+    { .x = 119, .y = 128, .z = 119, .voxel_id = 1 },
+    { .x = 119, .y = 129, .z = 119, .voxel_id = 1 },
+    { .x = 119, .y = 130, .z = 119, .voxel_id = 1 },
+    { .x = 119, .y = 122, .z = 120, .voxel_id = 1 },
+    { .x = 119, .y = 123, .z = 120, .voxel_id = 1 },
+    { .x = 119, .y = 124, .z = 120, .voxel_id = 1 },
+    { .x = 119, .y = 125, .z = 120, .voxel_id = 1 },
+    { .x = 119, .y = 126, .z = 120, .voxel_id = 1 },
+    { .x = 119, .y = 127, .z = 120, .voxel_id = 1 },
+    { .x = 119, .y = 128, .z = 120, .voxel_id = 1 },
+    { .x = 119, .y = 129, .z = 120, .voxel_id = 1 },
+    { .x = 119, .y = 130, .z = 120, .voxel_id = 1 },
+    { .x = 119, .y = 131, .z = 120, .voxel_id = 1 },
+    { .x = 119, .y = 123, .z = 121, .voxel_id = 1 },
+    { .x = 119, .y = 124, .z = 121, .voxel_id = 1 },
+    { .x = 119, .y = 125, .z = 121, .voxel_id = 1 },
+    { .x = 119, .y = 126, .z = 121, .voxel_id = 1 },
+    { .x = 119, .y = 128, .z = 121, .voxel_id = 1 },
+    { .x = 119, .y = 129, .z = 121, .voxel_id = 1 },
+    { .x = 119, .y = 130, .z = 121, .voxel_id = 1 },
+    { .x = 119, .y = 123, .z = 122, .voxel_id = 1 },
+    { .x = 119, .y = 124, .z = 122, .voxel_id = 1 },
+    { .x = 119, .y = 125, .z = 122, .voxel_id = 1 },
+    { .x = 119, .y = 130, .z = 122, .voxel_id = 1 },
+    { .x = 119, .y = 123, .z = 123, .voxel_id = 1 },
+    { .x = 119, .y = 124, .z = 123, .voxel_id = 1 },
+    { .x = 119, .y = 125, .z = 123, .voxel_id = 1 },
+    { .x = 119, .y = 128, .z = 123, .voxel_id = 1 },
+    { .x = 119, .y = 129, .z = 123, .voxel_id = 1 },
+    { .x = 119, .y = 130, .z = 123, .voxel_id = 1 },
+    { .x = 119, .y = 123, .z = 124, .voxel_id = 1 },
+    { .x = 119, .y = 124, .z = 124, .voxel_id = 1 },
+    { .x = 119, .y = 125, .z = 124, .voxel_id = 1 },
+    { .x = 119, .y = 126, .z = 124, .voxel_id = 1 },
+    { .x = 119, .y = 129, .z = 124, .voxel_id = 1 },
+    { .x = 119, .y = 124, .z = 125, .voxel_id = 1 },
+    { .x = 119, .y = 125, .z = 125, .voxel_id = 1 },
+    { .x = 119, .y = 126, .z = 125, .voxel_id = 1 },
+    { .x = 119, .y = 127, .z = 125, .voxel_id = 1 },
+    { .x = 119, .y = 128, .z = 125, .voxel_id = 1 },
+    { .x = 119, .y = 129, .z = 125, .voxel_id = 1 },
+    { .x = 119, .y = 124, .z = 126, .voxel_id = 1 },
+    { .x = 119, .y = 125, .z = 126, .voxel_id = 1 },
+    { .x = 119, .y = 126, .z = 126, .voxel_id = 1 },
+    { .x = 119, .y = 127, .z = 126, .voxel_id = 1 },
+    { .x = 119, .y = 128, .z = 126, .voxel_id = 1 },
+    { .x = 119, .y = 124, .z = 127, .voxel_id = 1 },
+    { .x = 119, .y = 125, .z = 127, .voxel_id = 1 },
+    { .x = 119, .y = 126, .z = 127, .voxel_id = 1 },
+    { .x = 119, .y = 127, .z = 127, .voxel_id = 1 },
+    { .x = 119, .y = 128, .z = 127, .voxel_id = 1 },
+    { .x = 119, .y = 124, .z = 128, .voxel_id = 1 },
+    { .x = 119, .y = 125, .z = 128, .voxel_id = 1 },
+    { .x = 119, .y = 126, .z = 128, .voxel_id = 1 },
+    { .x = 119, .y = 127, .z = 128, .voxel_id = 1 },
+    { .x = 119, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 119, .y = 126, .z = 129, .voxel_id = 1 },
+    { .x = 119, .y = 127, .z = 129, .voxel_id = 1 },
+    { .x = 119, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 119, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 120, .y = 125, .z = 116, .voxel_id = 1 },
+    { .x = 120, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 120, .y = 127, .z = 116, .voxel_id = 1 },
+    { .x = 120, .y = 128, .z = 116, .voxel_id = 1 },
+    { .x = 120, .y = 129, .z = 116, .voxel_id = 1 },
+    { .x = 120, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 120, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 120, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 120, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 120, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 120, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 120, .y = 129, .z = 117, .voxel_id = 1 },
+    { .x = 120, .y = 130, .z = 117, .voxel_id = 1 },
+    { .x = 120, .y = 131, .z = 117, .voxel_id = 1 },
+    { .x = 120, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 120, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 120, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 120, .y = 123, .z = 119, .voxel_id = 1 },
+    { .x = 120, .y = 130, .z = 119, .voxel_id = 1 },
+    { .x = 120, .y = 131, .z = 119, .voxel_id = 1 },
+    { .x = 120, .y = 122, .z = 120, .voxel_id = 1 },
+    { .x = 120, .y = 123, .z = 120, .voxel_id = 1 },
+    { .x = 120, .y = 124, .z = 120, .voxel_id = 1 },
+    { .x = 120, .y = 130, .z = 120, .voxel_id = 1 },
+    { .x = 120, .y = 131, .z = 120, .voxel_id = 1 },
+    { .x = 120, .y = 132, .z = 120, .voxel_id = 1 },
+    { .x = 120, .y = 122, .z = 121, .voxel_id = 1 },
+    { .x = 120, .y = 123, .z = 121, .voxel_id = 1 },
+    { .x = 120, .y = 124, .z = 121, .voxel_id = 1 },
+    { .x = 120, .y = 130, .z = 121, .voxel_id = 1 },
+    { .x = 120, .y = 131, .z = 121, .voxel_id = 1 },
+    { .x = 120, .y = 122, .z = 122, .voxel_id = 1 },
+    { .x = 120, .y = 123, .z = 122, .voxel_id = 1 },
+    { .x = 120, .y = 130, .z = 122, .voxel_id = 1 },
+    { .x = 120, .y = 131, .z = 122, .voxel_id = 1 },
+    { .x = 120, .y = 122, .z = 123, .voxel_id = 1 },
+    { .x = 120, .y = 123, .z = 123, .voxel_id = 1 },
+    { .x = 120, .y = 130, .z = 123, .voxel_id = 1 },
+    { .x = 120, .y = 131, .z = 123, .voxel_id = 1 },
+    { .x = 120, .y = 123, .z = 124, .voxel_id = 1 },
+    { .x = 120, .y = 124, .z = 124, .voxel_id = 1 },
+    { .x = 120, .y = 129, .z = 124, .voxel_id = 1 },
+    { .x = 120, .y = 123, .z = 125, .voxel_id = 1 },
+    { .x = 120, .y = 124, .z = 125, .voxel_id = 1 },
+    { .x = 120, .y = 128, .z = 125, .voxel_id = 1 },
+    { .x = 120, .y = 129, .z = 125, .voxel_id = 1 },
+    { .x = 120, .y = 123, .z = 126, .voxel_id = 1 },
+    { .x = 120, .y = 124, .z = 126, .voxel_id = 1 },
+    { .x = 120, .y = 125, .z = 126, .voxel_id = 1 },
+    { .x = 120, .y = 128, .z = 126, .voxel_id = 1 },
+    { .x = 120, .y = 123, .z = 127, .voxel_id = 1 },
+    { .x = 120, .y = 124, .z = 127, .voxel_id = 1 },
+    { .x = 120, .y = 128, .z = 127, .voxel_id = 1 },
+    { .x = 120, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 120, .y = 123, .z = 128, .voxel_id = 1 },
+    { .x = 120, .y = 124, .z = 128, .voxel_id = 1 },
+    { .x = 120, .y = 125, .z = 128, .voxel_id = 1 },
+    { .x = 120, .y = 126, .z = 128, .voxel_id = 1 },
+    { .x = 120, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 120, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 120, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 120, .y = 125, .z = 129, .voxel_id = 1 },
+    { .x = 120, .y = 126, .z = 129, .voxel_id = 1 },
+    { .x = 120, .y = 127, .z = 129, .voxel_id = 1 },
+    { .x = 120, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 120, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 120, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 120, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 121, .y = 126, .z = 115, .voxel_id = 1 },
+    { .x = 121, .y = 127, .z = 115, .voxel_id = 1 },
+    { .x = 121, .y = 129, .z = 115, .voxel_id = 1 },
+    { .x = 121, .y = 123, .z = 116, .voxel_id = 1 },
+    { .x = 121, .y = 124, .z = 116, .voxel_id = 1 },
+    { .x = 121, .y = 125, .z = 116, .voxel_id = 1 },
+    { .x = 121, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 121, .y = 127, .z = 116, .voxel_id = 1 },
+    { .x = 121, .y = 128, .z = 116, .voxel_id = 1 },
+    { .x = 121, .y = 129, .z = 116, .voxel_id = 1 },
+    { .x = 121, .y = 130, .z = 116, .voxel_id = 1 },
+    { .x = 121, .y = 131, .z = 116, .voxel_id = 1 },
+    { .x = 121, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 121, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 121, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 121, .y = 129, .z = 117, .voxel_id = 1 },
+    { .x = 121, .y = 130, .z = 117, .voxel_id = 1 },
+    { .x = 121, .y = 131, .z = 117, .voxel_id = 1 },
+    { .x = 121, .y = 132, .z = 117, .voxel_id = 1 },
+    { .x = 121, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 121, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 121, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 121, .y = 123, .z = 119, .voxel_id = 1 },
+    { .x = 121, .y = 132, .z = 119, .voxel_id = 1 },
+    { .x = 121, .y = 122, .z = 120, .voxel_id = 1 },
+    { .x = 121, .y = 132, .z = 120, .voxel_id = 1 },
+    { .x = 121, .y = 133, .z = 120, .voxel_id = 1 },
+    { .x = 121, .y = 122, .z = 121, .voxel_id = 1 },
+    { .x = 121, .y = 122, .z = 122, .voxel_id = 1 },
+    { .x = 121, .y = 131, .z = 122, .voxel_id = 1 },
+    { .x = 121, .y = 132, .z = 122, .voxel_id = 1 },
+    { .x = 121, .y = 122, .z = 123, .voxel_id = 1 },
+    { .x = 121, .y = 131, .z = 123, .voxel_id = 1 },
+    { .x = 121, .y = 132, .z = 123, .voxel_id = 1 },
+    { .x = 121, .y = 123, .z = 125, .voxel_id = 1 },
+    { .x = 121, .y = 128, .z = 125, .voxel_id = 1 },
+    { .x = 121, .y = 129, .z = 125, .voxel_id = 1 },
+    { .x = 121, .y = 130, .z = 125, .voxel_id = 1 },
+    { .x = 121, .y = 123, .z = 126, .voxel_id = 1 },
+    { .x = 121, .y = 124, .z = 126, .voxel_id = 1 },
+    { .x = 121, .y = 128, .z = 126, .voxel_id = 1 },
+    { .x = 121, .y = 129, .z = 126, .voxel_id = 1 },
+    { .x = 121, .y = 123, .z = 127, .voxel_id = 1 },
+    { .x = 121, .y = 124, .z = 127, .voxel_id = 1 },
+    { .x = 121, .y = 128, .z = 127, .voxel_id = 1 },
+    { .x = 121, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 121, .y = 122, .z = 128, .voxel_id = 1 },
+    { .x = 121, .y = 123, .z = 128, .voxel_id = 1 },
+    { .x = 121, .y = 124, .z = 128, .voxel_id = 1 },
+    { .x = 121, .y = 125, .z = 128, .voxel_id = 1 },
+    { .x = 121, .y = 126, .z = 128, .voxel_id = 1 },
+    { .x = 121, .y = 127, .z = 128, .voxel_id = 1 },
+    { .x = 121, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 121, .y = 123, .z = 129, .voxel_id = 1 },
+    { .x = 121, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 121, .y = 125, .z = 129, .voxel_id = 1 },
+    { .x = 121, .y = 126, .z = 129, .voxel_id = 1 },
+    { .x = 121, .y = 127, .z = 129, .voxel_id = 1 },
+    { .x = 121, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 121, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 121, .y = 130, .z = 129, .voxel_id = 1 },
+    { .x = 121, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 121, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 121, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 122, .y = 127, .z = 114, .voxel_id = 1 },
+    { .x = 122, .y = 128, .z = 114, .voxel_id = 1 },
+    { .x = 122, .y = 129, .z = 114, .voxel_id = 1 },
+    { .x = 122, .y = 124, .z = 115, .voxel_id = 1 },
+    { .x = 122, .y = 125, .z = 115, .voxel_id = 1 },
+    { .x = 122, .y = 126, .z = 115, .voxel_id = 1 },
+    { .x = 122, .y = 127, .z = 115, .voxel_id = 1 },
+    { .x = 122, .y = 128, .z = 115, .voxel_id = 1 },
+    { .x = 122, .y = 129, .z = 115, .voxel_id = 1 },
+    { .x = 122, .y = 130, .z = 115, .voxel_id = 1 },
+    { .x = 122, .y = 123, .z = 116, .voxel_id = 1 },
+    { .x = 122, .y = 124, .z = 116, .voxel_id = 1 },
+    { .x = 122, .y = 125, .z = 116, .voxel_id = 1 },
+    { .x = 122, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 122, .y = 129, .z = 116, .voxel_id = 1 },
+    { .x = 122, .y = 130, .z = 116, .voxel_id = 1 },
+    { .x = 122, .y = 131, .z = 116, .voxel_id = 1 },
+    { .x = 122, .y = 122, .z = 117, .voxel_id = 1 },
+    { .x = 122, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 122, .y = 131, .z = 117, .voxel_id = 1 },
+    { .x = 122, .y = 132, .z = 117, .voxel_id = 1 },
+    { .x = 122, .y = 133, .z = 117, .voxel_id = 1 },
+    { .x = 122, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 122, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 122, .y = 132, .z = 118, .voxel_id = 1 },
+    { .x = 122, .y = 133, .z = 118, .voxel_id = 1 },
+    { .x = 122, .y = 121, .z = 119, .voxel_id = 1 },
+    { .x = 122, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 122, .y = 132, .z = 119, .voxel_id = 1 },
+    { .x = 122, .y = 133, .z = 119, .voxel_id = 1 },
+    { .x = 122, .y = 121, .z = 120, .voxel_id = 1 },
+    { .x = 122, .y = 122, .z = 120, .voxel_id = 1 },
+    { .x = 122, .y = 132, .z = 120, .voxel_id = 1 },
+    { .x = 122, .y = 133, .z = 120, .voxel_id = 1 },
+    { .x = 122, .y = 121, .z = 121, .voxel_id = 1 },
+    { .x = 122, .y = 122, .z = 121, .voxel_id = 1 },
+    { .x = 122, .y = 133, .z = 121, .voxel_id = 1 },
+    { .x = 122, .y = 121, .z = 122, .voxel_id = 1 },
+    { .x = 122, .y = 122, .z = 122, .voxel_id = 1 },
+    { .x = 122, .y = 132, .z = 122, .voxel_id = 1 },
+    { .x = 122, .y = 133, .z = 122, .voxel_id = 1 },
+    { .x = 122, .y = 122, .z = 123, .voxel_id = 1 },
+    { .x = 122, .y = 132, .z = 123, .voxel_id = 1 },
+    { .x = 122, .y = 133, .z = 123, .voxel_id = 1 },
+    { .x = 122, .y = 122, .z = 124, .voxel_id = 1 },
+    { .x = 122, .y = 132, .z = 124, .voxel_id = 1 },
+    { .x = 122, .y = 133, .z = 124, .voxel_id = 1 },
+    { .x = 122, .y = 122, .z = 125, .voxel_id = 1 },
+    { .x = 122, .y = 123, .z = 125, .voxel_id = 1 },
+    { .x = 122, .y = 129, .z = 125, .voxel_id = 1 },
+    { .x = 122, .y = 130, .z = 125, .voxel_id = 1 },
+    { .x = 122, .y = 131, .z = 125, .voxel_id = 1 },
+    { .x = 122, .y = 132, .z = 125, .voxel_id = 1 },
+    { .x = 122, .y = 122, .z = 126, .voxel_id = 1 },
+    { .x = 122, .y = 123, .z = 126, .voxel_id = 1 },
+    { .x = 122, .y = 129, .z = 126, .voxel_id = 1 },
+    { .x = 122, .y = 130, .z = 126, .voxel_id = 1 },
+    { .x = 122, .y = 131, .z = 126, .voxel_id = 1 },
+    { .x = 122, .y = 122, .z = 127, .voxel_id = 1 },
+    { .x = 122, .y = 123, .z = 127, .voxel_id = 1 },
+    { .x = 122, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 122, .y = 122, .z = 128, .voxel_id = 1 },
+    { .x = 122, .y = 123, .z = 128, .voxel_id = 1 },
+    { .x = 122, .y = 124, .z = 128, .voxel_id = 1 },
+    { .x = 122, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 122, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 122, .y = 130, .z = 128, .voxel_id = 1 },
+    { .x = 122, .y = 123, .z = 129, .voxel_id = 1 },
+    { .x = 122, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 122, .y = 125, .z = 129, .voxel_id = 1 },
+    { .x = 122, .y = 126, .z = 129, .voxel_id = 1 },
+    { .x = 122, .y = 127, .z = 129, .voxel_id = 1 },
+    { .x = 122, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 122, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 122, .y = 130, .z = 129, .voxel_id = 1 },
+    { .x = 122, .y = 124, .z = 130, .voxel_id = 1 },
+    { .x = 122, .y = 125, .z = 130, .voxel_id = 1 },
+    { .x = 122, .y = 126, .z = 130, .voxel_id = 1 },
+    { .x = 122, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 122, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 122, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 122, .y = 130, .z = 130, .voxel_id = 1 },
+    { .x = 122, .y = 129, .z = 131, .voxel_id = 1 },
+    { .x = 123, .y = 125, .z = 114, .voxel_id = 1 },
+    { .x = 123, .y = 126, .z = 114, .voxel_id = 1 },
+    { .x = 123, .y = 127, .z = 114, .voxel_id = 1 },
+    { .x = 123, .y = 128, .z = 114, .voxel_id = 1 },
+    { .x = 123, .y = 129, .z = 114, .voxel_id = 1 },
+    { .x = 123, .y = 123, .z = 115, .voxel_id = 1 },
+    { .x = 123, .y = 124, .z = 115, .voxel_id = 1 },
+    { .x = 123, .y = 129, .z = 115, .voxel_id = 1 },
+    { .x = 123, .y = 130, .z = 115, .voxel_id = 1 },
+    { .x = 123, .y = 131, .z = 115, .voxel_id = 1 },
+    { .x = 123, .y = 122, .z = 116, .voxel_id = 1 },
+    { .x = 123, .y = 123, .z = 116, .voxel_id = 1 },
+    { .x = 123, .y = 124, .z = 116, .voxel_id = 1 },
+    { .x = 123, .y = 130, .z = 116, .voxel_id = 1 },
+    { .x = 123, .y = 131, .z = 116, .voxel_id = 1 },
+    { .x = 123, .y = 132, .z = 116, .voxel_id = 1 },
+    { .x = 123, .y = 121, .z = 117, .voxel_id = 1 },
+    { .x = 123, .y = 122, .z = 117, .voxel_id = 1 },
+    { .x = 123, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 123, .y = 131, .z = 117, .voxel_id = 1 },
+    { .x = 123, .y = 132, .z = 117, .voxel_id = 1 },
+    { .x = 123, .y = 133, .z = 117, .voxel_id = 1 },
+    { .x = 123, .y = 121, .z = 118, .voxel_id = 1 },
+    { .x = 123, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 123, .y = 133, .z = 118, .voxel_id = 1 },
+    { .x = 123, .y = 121, .z = 119, .voxel_id = 1 },
+    { .x = 123, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 123, .y = 133, .z = 119, .voxel_id = 1 },
+    { .x = 123, .y = 121, .z = 120, .voxel_id = 1 },
+    { .x = 123, .y = 133, .z = 120, .voxel_id = 1 },
+    { .x = 123, .y = 134, .z = 120, .voxel_id = 1 },
+    { .x = 123, .y = 121, .z = 121, .voxel_id = 1 },
+    { .x = 123, .y = 133, .z = 121, .voxel_id = 1 },
+    { .x = 123, .y = 134, .z = 121, .voxel_id = 1 },
+    { .x = 123, .y = 121, .z = 122, .voxel_id = 1 },
+    { .x = 123, .y = 122, .z = 122, .voxel_id = 1 },
+    { .x = 123, .y = 133, .z = 122, .voxel_id = 1 },
+    { .x = 123, .y = 121, .z = 123, .voxel_id = 1 },
+    { .x = 123, .y = 122, .z = 123, .voxel_id = 1 },
+    { .x = 123, .y = 133, .z = 123, .voxel_id = 1 },
+    { .x = 123, .y = 121, .z = 124, .voxel_id = 1 },
+    { .x = 123, .y = 122, .z = 124, .voxel_id = 1 },
+    { .x = 123, .y = 132, .z = 124, .voxel_id = 1 },
+    { .x = 123, .y = 133, .z = 124, .voxel_id = 1 },
+    { .x = 123, .y = 122, .z = 125, .voxel_id = 1 },
+    { .x = 123, .y = 131, .z = 125, .voxel_id = 1 },
+    { .x = 123, .y = 132, .z = 125, .voxel_id = 1 },
+    { .x = 123, .y = 133, .z = 125, .voxel_id = 1 },
+    { .x = 123, .y = 122, .z = 126, .voxel_id = 1 },
+    { .x = 123, .y = 129, .z = 126, .voxel_id = 1 },
+    { .x = 123, .y = 130, .z = 126, .voxel_id = 1 },
+    { .x = 123, .y = 131, .z = 126, .voxel_id = 1 },
+    { .x = 123, .y = 122, .z = 127, .voxel_id = 1 },
+    { .x = 123, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 123, .y = 130, .z = 127, .voxel_id = 1 },
+    { .x = 123, .y = 113, .z = 128, .voxel_id = 1 },
+    { .x = 123, .y = 114, .z = 128, .voxel_id = 1 },
+    { .x = 123, .y = 122, .z = 128, .voxel_id = 1 },
+    { .x = 123, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 123, .y = 130, .z = 128, .voxel_id = 1 },
+    { .x = 123, .y = 122, .z = 129, .voxel_id = 1 },
+    { .x = 123, .y = 123, .z = 129, .voxel_id = 1 },
+    { .x = 123, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 123, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 123, .y = 130, .z = 129, .voxel_id = 1 },
+    { .x = 123, .y = 131, .z = 129, .voxel_id = 1 },
+    { .x = 123, .y = 123, .z = 130, .voxel_id = 1 },
+    { .x = 123, .y = 124, .z = 130, .voxel_id = 1 },
+    { .x = 123, .y = 125, .z = 130, .voxel_id = 1 },
+    { .x = 123, .y = 126, .z = 130, .voxel_id = 1 },
+    { .x = 123, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 123, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 123, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 123, .y = 130, .z = 130, .voxel_id = 1 },
+    { .x = 123, .y = 131, .z = 130, .voxel_id = 1 },
+    { .x = 123, .y = 125, .z = 131, .voxel_id = 1 },
+    { .x = 123, .y = 126, .z = 131, .voxel_id = 1 },
+    { .x = 123, .y = 127, .z = 131, .voxel_id = 1 },
+    { .x = 123, .y = 129, .z = 131, .voxel_id = 1 },
+    { .x = 123, .y = 130, .z = 131, .voxel_id = 1 },
+    { .x = 124, .y = 128, .z = 113, .voxel_id = 1 },
+    { .x = 124, .y = 129, .z = 113, .voxel_id = 1 },
+    { .x = 124, .y = 123, .z = 114, .voxel_id = 1 },
+    { .x = 124, .y = 124, .z = 114, .voxel_id = 1 },
+    { .x = 124, .y = 125, .z = 114, .voxel_id = 1 },
+    { .x = 124, .y = 126, .z = 114, .voxel_id = 1 },
+    { .x = 124, .y = 127, .z = 114, .voxel_id = 1 },
+    { .x = 124, .y = 128, .z = 114, .voxel_id = 1 },
+    { .x = 124, .y = 129, .z = 114, .voxel_id = 1 },
+    { .x = 124, .y = 122, .z = 115, .voxel_id = 1 },
+    { .x = 124, .y = 123, .z = 115, .voxel_id = 1 },
+    { .x = 124, .y = 124, .z = 115, .voxel_id = 1 },
+    { .x = 124, .y = 129, .z = 115, .voxel_id = 1 },
+    { .x = 124, .y = 130, .z = 115, .voxel_id = 1 },
+    { .x = 124, .y = 131, .z = 115, .voxel_id = 1 },
+    { .x = 124, .y = 121, .z = 116, .voxel_id = 1 },
+    { .x = 124, .y = 122, .z = 116, .voxel_id = 1 },
+    { .x = 124, .y = 123, .z = 116, .voxel_id = 1 },
+    { .x = 124, .y = 131, .z = 116, .voxel_id = 1 },
+    { .x = 124, .y = 132, .z = 116, .voxel_id = 1 },
+    { .x = 124, .y = 121, .z = 117, .voxel_id = 1 },
+    { .x = 124, .y = 122, .z = 117, .voxel_id = 1 },
+    { .x = 124, .y = 132, .z = 117, .voxel_id = 1 },
+    { .x = 124, .y = 133, .z = 117, .voxel_id = 1 },
+    { .x = 124, .y = 120, .z = 118, .voxel_id = 1 },
+    { .x = 124, .y = 121, .z = 118, .voxel_id = 1 },
+    { .x = 124, .y = 133, .z = 118, .voxel_id = 1 },
+    { .x = 124, .y = 120, .z = 119, .voxel_id = 1 },
+    { .x = 124, .y = 121, .z = 119, .voxel_id = 1 },
+    { .x = 124, .y = 133, .z = 119, .voxel_id = 1 },
+    { .x = 124, .y = 120, .z = 120, .voxel_id = 1 },
+    { .x = 124, .y = 121, .z = 120, .voxel_id = 1 },
+    { .x = 124, .y = 133, .z = 120, .voxel_id = 1 },
+    { .x = 124, .y = 134, .z = 120, .voxel_id = 1 },
+    { .x = 124, .y = 120, .z = 121, .voxel_id = 1 },
+    { .x = 124, .y = 121, .z = 121, .voxel_id = 1 },
+    { .x = 124, .y = 134, .z = 121, .voxel_id = 1 },
+    { .x = 124, .y = 120, .z = 122, .voxel_id = 1 },
+    { .x = 124, .y = 133, .z = 122, .voxel_id = 1 },
+    { .x = 124, .y = 133, .z = 123, .voxel_id = 1 },
+    { .x = 124, .y = 120, .z = 124, .voxel_id = 1 },
+    { .x = 124, .y = 121, .z = 124, .voxel_id = 1 },
+    { .x = 124, .y = 133, .z = 124, .voxel_id = 1 },
+    { .x = 124, .y = 120, .z = 125, .voxel_id = 1 },
+    { .x = 124, .y = 121, .z = 125, .voxel_id = 1 },
+    { .x = 124, .y = 131, .z = 125, .voxel_id = 1 },
+    { .x = 124, .y = 132, .z = 125, .voxel_id = 1 },
+    { .x = 124, .y = 133, .z = 125, .voxel_id = 1 },
+    { .x = 124, .y = 113, .z = 126, .voxel_id = 1 },
+    { .x = 124, .y = 114, .z = 126, .voxel_id = 1 },
+    { .x = 124, .y = 115, .z = 126, .voxel_id = 1 },
+    { .x = 124, .y = 116, .z = 126, .voxel_id = 1 },
+    { .x = 124, .y = 121, .z = 126, .voxel_id = 1 },
+    { .x = 124, .y = 130, .z = 126, .voxel_id = 1 },
+    { .x = 124, .y = 131, .z = 126, .voxel_id = 1 },
+    { .x = 124, .y = 132, .z = 126, .voxel_id = 1 },
+    { .x = 124, .y = 113, .z = 127, .voxel_id = 1 },
+    { .x = 124, .y = 114, .z = 127, .voxel_id = 1 },
+    { .x = 124, .y = 115, .z = 127, .voxel_id = 1 },
+    { .x = 124, .y = 116, .z = 127, .voxel_id = 1 },
+    { .x = 124, .y = 117, .z = 127, .voxel_id = 1 },
+    { .x = 124, .y = 118, .z = 127, .voxel_id = 1 },
+    { .x = 124, .y = 119, .z = 127, .voxel_id = 1 },
+    { .x = 124, .y = 121, .z = 127, .voxel_id = 1 },
+    { .x = 124, .y = 122, .z = 127, .voxel_id = 1 },
+    { .x = 124, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 124, .y = 130, .z = 127, .voxel_id = 1 },
+    { .x = 124, .y = 113, .z = 128, .voxel_id = 1 },
+    { .x = 124, .y = 114, .z = 128, .voxel_id = 1 },
+    { .x = 124, .y = 115, .z = 128, .voxel_id = 1 },
+    { .x = 124, .y = 116, .z = 128, .voxel_id = 1 },
+    { .x = 124, .y = 117, .z = 128, .voxel_id = 1 },
+    { .x = 124, .y = 118, .z = 128, .voxel_id = 1 },
+    { .x = 124, .y = 119, .z = 128, .voxel_id = 1 },
+    { .x = 124, .y = 121, .z = 128, .voxel_id = 1 },
+    { .x = 124, .y = 122, .z = 128, .voxel_id = 1 },
+    { .x = 124, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 124, .y = 130, .z = 128, .voxel_id = 1 },
+    { .x = 124, .y = 131, .z = 128, .voxel_id = 1 },
+    { .x = 124, .y = 113, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 114, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 115, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 116, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 117, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 118, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 119, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 122, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 123, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 131, .z = 129, .voxel_id = 1 },
+    { .x = 124, .y = 123, .z = 130, .voxel_id = 1 },
+    { .x = 124, .y = 124, .z = 130, .voxel_id = 1 },
+    { .x = 124, .y = 125, .z = 130, .voxel_id = 1 },
+    { .x = 124, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 124, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 124, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 124, .y = 130, .z = 130, .voxel_id = 1 },
+    { .x = 124, .y = 131, .z = 130, .voxel_id = 1 },
+    { .x = 124, .y = 132, .z = 130, .voxel_id = 1 },
+    { .x = 124, .y = 125, .z = 131, .voxel_id = 1 },
+    { .x = 124, .y = 126, .z = 131, .voxel_id = 1 },
+    { .x = 124, .y = 127, .z = 131, .voxel_id = 1 },
+    { .x = 124, .y = 129, .z = 131, .voxel_id = 1 },
+    { .x = 124, .y = 130, .z = 131, .voxel_id = 1 },
+    { .x = 124, .y = 131, .z = 131, .voxel_id = 1 },
+    { .x = 125, .y = 127, .z = 113, .voxel_id = 1 },
+    { .x = 125, .y = 128, .z = 113, .voxel_id = 1 },
+    { .x = 125, .y = 129, .z = 113, .voxel_id = 1 },
+    { .x = 125, .y = 123, .z = 114, .voxel_id = 1 },
+    { .x = 125, .y = 124, .z = 114, .voxel_id = 1 },
+    { .x = 125, .y = 125, .z = 114, .voxel_id = 1 },
+    { .x = 125, .y = 126, .z = 114, .voxel_id = 1 },
+    { .x = 125, .y = 127, .z = 114, .voxel_id = 1 },
+    { .x = 125, .y = 128, .z = 114, .voxel_id = 1 },
+    { .x = 125, .y = 121, .z = 115, .voxel_id = 1 },
+    { .x = 125, .y = 122, .z = 115, .voxel_id = 1 },
+    { .x = 125, .y = 123, .z = 115, .voxel_id = 1 },
+    { .x = 125, .y = 130, .z = 115, .voxel_id = 1 },
+    { .x = 125, .y = 131, .z = 115, .voxel_id = 1 },
+    { .x = 125, .y = 132, .z = 115, .voxel_id = 1 },
+    { .x = 125, .y = 121, .z = 116, .voxel_id = 1 },
+    { .x = 125, .y = 122, .z = 116, .voxel_id = 1 },
+    { .x = 125, .y = 131, .z = 116, .voxel_id = 1 },
+    { .x = 125, .y = 132, .z = 116, .voxel_id = 1 },
+    { .x = 125, .y = 133, .z = 116, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 117, .voxel_id = 1 },
+    { .x = 125, .y = 121, .z = 117, .voxel_id = 1 },
+    { .x = 125, .y = 132, .z = 117, .voxel_id = 1 },
+    { .x = 125, .y = 133, .z = 117, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 118, .voxel_id = 1 },
+    { .x = 125, .y = 121, .z = 118, .voxel_id = 1 },
+    { .x = 125, .y = 119, .z = 119, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 119, .voxel_id = 1 },
+    { .x = 125, .y = 133, .z = 119, .voxel_id = 1 },
+    { .x = 125, .y = 134, .z = 119, .voxel_id = 1 },
+    { .x = 125, .y = 119, .z = 120, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 120, .voxel_id = 1 },
+    { .x = 125, .y = 133, .z = 120, .voxel_id = 1 },
+    { .x = 125, .y = 134, .z = 120, .voxel_id = 1 },
+    { .x = 125, .y = 119, .z = 121, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 121, .voxel_id = 1 },
+    { .x = 125, .y = 134, .z = 121, .voxel_id = 1 },
+    { .x = 125, .y = 119, .z = 122, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 122, .voxel_id = 1 },
+    { .x = 125, .y = 119, .z = 123, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 123, .voxel_id = 1 },
+    { .x = 125, .y = 133, .z = 123, .voxel_id = 1 },
+    { .x = 125, .y = 119, .z = 124, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 124, .voxel_id = 1 },
+    { .x = 125, .y = 133, .z = 124, .voxel_id = 1 },
+    { .x = 125, .y = 119, .z = 125, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 125, .voxel_id = 1 },
+    { .x = 125, .y = 121, .z = 125, .voxel_id = 1 },
+    { .x = 125, .y = 133, .z = 125, .voxel_id = 1 },
+    { .x = 125, .y = 113, .z = 126, .voxel_id = 1 },
+    { .x = 125, .y = 114, .z = 126, .voxel_id = 1 },
+    { .x = 125, .y = 115, .z = 126, .voxel_id = 1 },
+    { .x = 125, .y = 116, .z = 126, .voxel_id = 1 },
+    { .x = 125, .y = 117, .z = 126, .voxel_id = 1 },
+    { .x = 125, .y = 118, .z = 126, .voxel_id = 1 },
+    { .x = 125, .y = 119, .z = 126, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 126, .voxel_id = 1 },
+    { .x = 125, .y = 121, .z = 126, .voxel_id = 1 },
+    { .x = 125, .y = 130, .z = 126, .voxel_id = 1 },
+    { .x = 125, .y = 131, .z = 126, .voxel_id = 1 },
+    { .x = 125, .y = 113, .z = 127, .voxel_id = 1 },
+    { .x = 125, .y = 114, .z = 127, .voxel_id = 1 },
+    { .x = 125, .y = 117, .z = 127, .voxel_id = 1 },
+    { .x = 125, .y = 118, .z = 127, .voxel_id = 1 },
+    { .x = 125, .y = 119, .z = 127, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 127, .voxel_id = 1 },
+    { .x = 125, .y = 121, .z = 127, .voxel_id = 1 },
+    { .x = 125, .y = 122, .z = 127, .voxel_id = 1 },
+    { .x = 125, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 125, .y = 130, .z = 127, .voxel_id = 1 },
+    { .x = 125, .y = 131, .z = 127, .voxel_id = 1 },
+    { .x = 125, .y = 113, .z = 128, .voxel_id = 1 },
+    { .x = 125, .y = 119, .z = 128, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 128, .voxel_id = 1 },
+    { .x = 125, .y = 121, .z = 128, .voxel_id = 1 },
+    { .x = 125, .y = 122, .z = 128, .voxel_id = 1 },
+    { .x = 125, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 125, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 125, .y = 130, .z = 128, .voxel_id = 1 },
+    { .x = 125, .y = 131, .z = 128, .voxel_id = 1 },
+    { .x = 125, .y = 113, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 114, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 115, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 116, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 117, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 118, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 119, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 121, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 130, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 131, .z = 129, .voxel_id = 1 },
+    { .x = 125, .y = 115, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 116, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 117, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 118, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 119, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 120, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 122, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 123, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 124, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 125, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 126, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 131, .z = 130, .voxel_id = 1 },
+    { .x = 125, .y = 125, .z = 131, .voxel_id = 1 },
+    { .x = 125, .y = 126, .z = 131, .voxel_id = 1 },
+    { .x = 125, .y = 127, .z = 131, .voxel_id = 1 },
+    { .x = 125, .y = 128, .z = 131, .voxel_id = 1 },
+    { .x = 125, .y = 129, .z = 131, .voxel_id = 1 },
+    { .x = 125, .y = 130, .z = 131, .voxel_id = 1 },
+    { .x = 125, .y = 131, .z = 131, .voxel_id = 1 },
+    { .x = 126, .y = 124, .z = 113, .voxel_id = 1 },
+    { .x = 126, .y = 127, .z = 113, .voxel_id = 1 },
+    { .x = 126, .y = 128, .z = 113, .voxel_id = 1 },
+    { .x = 126, .y = 129, .z = 113, .voxel_id = 1 },
+    { .x = 126, .y = 123, .z = 114, .voxel_id = 1 },
+    { .x = 126, .y = 124, .z = 114, .voxel_id = 1 },
+    { .x = 126, .y = 126, .z = 114, .voxel_id = 1 },
+    { .x = 126, .y = 127, .z = 114, .voxel_id = 1 },
+    { .x = 126, .y = 121, .z = 115, .voxel_id = 1 },
+    { .x = 126, .y = 131, .z = 115, .voxel_id = 1 },
+    { .x = 126, .y = 132, .z = 115, .voxel_id = 1 },
+    { .x = 126, .y = 121, .z = 116, .voxel_id = 1 },
+    { .x = 126, .y = 132, .z = 116, .voxel_id = 1 },
+    { .x = 126, .y = 133, .z = 116, .voxel_id = 1 },
+    { .x = 126, .y = 120, .z = 117, .voxel_id = 1 },
+    { .x = 126, .y = 121, .z = 117, .voxel_id = 1 },
+    { .x = 126, .y = 133, .z = 117, .voxel_id = 1 },
+    { .x = 126, .y = 119, .z = 118, .voxel_id = 1 },
+    { .x = 126, .y = 120, .z = 118, .voxel_id = 1 },
+    { .x = 126, .y = 119, .z = 119, .voxel_id = 1 },
+    { .x = 126, .y = 120, .z = 119, .voxel_id = 1 },
+    { .x = 126, .y = 119, .z = 120, .voxel_id = 1 },
+    { .x = 126, .y = 134, .z = 120, .voxel_id = 1 },
+    { .x = 126, .y = 119, .z = 121, .voxel_id = 1 },
+    { .x = 126, .y = 134, .z = 121, .voxel_id = 1 },
+    { .x = 126, .y = 119, .z = 122, .voxel_id = 1 },
+    { .x = 126, .y = 119, .z = 123, .voxel_id = 1 },
+    { .x = 126, .y = 133, .z = 123, .voxel_id = 1 },
+    { .x = 126, .y = 119, .z = 124, .voxel_id = 1 },
+    { .x = 126, .y = 133, .z = 124, .voxel_id = 1 },
+    { .x = 126, .y = 118, .z = 125, .voxel_id = 1 },
+    { .x = 126, .y = 119, .z = 125, .voxel_id = 1 },
+    { .x = 126, .y = 133, .z = 125, .voxel_id = 1 },
+    { .x = 126, .y = 114, .z = 126, .voxel_id = 1 },
+    { .x = 126, .y = 115, .z = 126, .voxel_id = 1 },
+    { .x = 126, .y = 116, .z = 126, .voxel_id = 1 },
+    { .x = 126, .y = 117, .z = 126, .voxel_id = 1 },
+    { .x = 126, .y = 118, .z = 126, .voxel_id = 1 },
+    { .x = 126, .y = 113, .z = 127, .voxel_id = 1 },
+    { .x = 126, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 126, .y = 130, .z = 127, .voxel_id = 1 },
+    { .x = 126, .y = 131, .z = 127, .voxel_id = 1 },
+    { .x = 126, .y = 113, .z = 128, .voxel_id = 1 },
+    { .x = 126, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 126, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 126, .y = 130, .z = 128, .voxel_id = 1 },
+    { .x = 126, .y = 113, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 114, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 115, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 120, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 121, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 122, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 125, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 126, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 127, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 130, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 131, .z = 129, .voxel_id = 1 },
+    { .x = 126, .y = 114, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 115, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 116, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 117, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 118, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 119, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 120, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 121, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 122, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 123, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 124, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 125, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 126, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 130, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 131, .z = 130, .voxel_id = 1 },
+    { .x = 126, .y = 121, .z = 131, .voxel_id = 1 },
+    { .x = 126, .y = 122, .z = 131, .voxel_id = 1 },
+    { .x = 126, .y = 123, .z = 131, .voxel_id = 1 },
+    { .x = 126, .y = 128, .z = 131, .voxel_id = 1 },
+    { .x = 126, .y = 129, .z = 131, .voxel_id = 1 },
+    { .x = 126, .y = 130, .z = 131, .voxel_id = 1 },
+    { .x = 126, .y = 131, .z = 131, .voxel_id = 1 },
+    { .x = 127, .y = 124, .z = 113, .voxel_id = 1 },
+    { .x = 127, .y = 128, .z = 113, .voxel_id = 1 },
+    { .x = 127, .y = 129, .z = 113, .voxel_id = 1 },
+    { .x = 127, .y = 121, .z = 114, .voxel_id = 1 },
+    { .x = 127, .y = 123, .z = 114, .voxel_id = 1 },
+    { .x = 127, .y = 124, .z = 114, .voxel_id = 1 },
+    { .x = 127, .y = 121, .z = 115, .voxel_id = 1 },
+    { .x = 127, .y = 121, .z = 116, .voxel_id = 1 },
+    { .x = 127, .y = 132, .z = 116, .voxel_id = 1 },
+    { .x = 127, .y = 133, .z = 116, .voxel_id = 1 },
+    { .x = 127, .y = 119, .z = 118, .voxel_id = 1 },
+    { .x = 127, .y = 119, .z = 119, .voxel_id = 1 },
+    { .x = 127, .y = 119, .z = 120, .voxel_id = 1 },
+    { .x = 127, .y = 134, .z = 120, .voxel_id = 1 },
+    { .x = 127, .y = 134, .z = 121, .voxel_id = 1 },
+    { .x = 127, .y = 118, .z = 124, .voxel_id = 1 },
+    { .x = 127, .y = 119, .z = 124, .voxel_id = 1 },
+    { .x = 127, .y = 133, .z = 124, .voxel_id = 1 },
+    { .x = 127, .y = 116, .z = 125, .voxel_id = 1 },
+    { .x = 127, .y = 117, .z = 125, .voxel_id = 1 },
+    { .x = 127, .y = 118, .z = 125, .voxel_id = 1 },
+    { .x = 127, .y = 133, .z = 125, .voxel_id = 1 },
+    { .x = 127, .y = 113, .z = 126, .voxel_id = 1 },
+    { .x = 127, .y = 114, .z = 126, .voxel_id = 1 },
+    { .x = 127, .y = 115, .z = 126, .voxel_id = 1 },
+    { .x = 127, .y = 116, .z = 126, .voxel_id = 1 },
+    { .x = 127, .y = 117, .z = 126, .voxel_id = 1 },
+    { .x = 127, .y = 113, .z = 127, .voxel_id = 1 },
+    { .x = 127, .y = 114, .z = 127, .voxel_id = 1 },
+    { .x = 127, .y = 130, .z = 127, .voxel_id = 1 },
+    { .x = 127, .y = 113, .z = 128, .voxel_id = 1 },
+    { .x = 127, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 127, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 127, .y = 130, .z = 128, .voxel_id = 1 },
+    { .x = 127, .y = 113, .z = 129, .voxel_id = 1 },
+    { .x = 127, .y = 114, .z = 129, .voxel_id = 1 },
+    { .x = 127, .y = 115, .z = 129, .voxel_id = 1 },
+    { .x = 127, .y = 126, .z = 129, .voxel_id = 1 },
+    { .x = 127, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 127, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 127, .y = 114, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 115, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 116, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 117, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 118, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 119, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 120, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 121, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 122, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 124, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 125, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 126, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 127, .y = 120, .z = 131, .voxel_id = 1 },
+    { .x = 127, .y = 121, .z = 131, .voxel_id = 1 },
+    { .x = 127, .y = 122, .z = 131, .voxel_id = 1 },
+    { .x = 127, .y = 126, .z = 131, .voxel_id = 1 },
+    { .x = 127, .y = 127, .z = 131, .voxel_id = 1 },
+    { .x = 127, .y = 128, .z = 131, .voxel_id = 1 },
+    { .x = 127, .y = 129, .z = 131, .voxel_id = 1 },
+    { .x = 128, .y = 124, .z = 113, .voxel_id = 1 },
+    { .x = 128, .y = 128, .z = 113, .voxel_id = 1 },
+    { .x = 128, .y = 129, .z = 113, .voxel_id = 1 },
+    { .x = 128, .y = 121, .z = 114, .voxel_id = 1 },
+    { .x = 128, .y = 123, .z = 114, .voxel_id = 1 },
+    { .x = 128, .y = 124, .z = 114, .voxel_id = 1 },
+    { .x = 128, .y = 121, .z = 115, .voxel_id = 1 },
+    { .x = 128, .y = 121, .z = 116, .voxel_id = 1 },
+    { .x = 128, .y = 132, .z = 116, .voxel_id = 1 },
+    { .x = 128, .y = 133, .z = 116, .voxel_id = 1 },
+    { .x = 128, .y = 119, .z = 118, .voxel_id = 1 },
+    { .x = 128, .y = 119, .z = 119, .voxel_id = 1 },
+    { .x = 128, .y = 119, .z = 120, .voxel_id = 1 },
+    { .x = 128, .y = 134, .z = 120, .voxel_id = 1 },
+    { .x = 128, .y = 134, .z = 121, .voxel_id = 1 },
+    { .x = 128, .y = 118, .z = 124, .voxel_id = 1 },
+    { .x = 128, .y = 119, .z = 124, .voxel_id = 1 },
+    { .x = 128, .y = 133, .z = 124, .voxel_id = 1 },
+    { .x = 128, .y = 116, .z = 125, .voxel_id = 1 },
+    { .x = 128, .y = 117, .z = 125, .voxel_id = 1 },
+    { .x = 128, .y = 118, .z = 125, .voxel_id = 1 },
+    { .x = 128, .y = 133, .z = 125, .voxel_id = 1 },
+    { .x = 128, .y = 113, .z = 126, .voxel_id = 1 },
+    { .x = 128, .y = 114, .z = 126, .voxel_id = 1 },
+    { .x = 128, .y = 115, .z = 126, .voxel_id = 1 },
+    { .x = 128, .y = 116, .z = 126, .voxel_id = 1 },
+    { .x = 128, .y = 117, .z = 126, .voxel_id = 1 },
+    { .x = 128, .y = 113, .z = 127, .voxel_id = 1 },
+    { .x = 128, .y = 114, .z = 127, .voxel_id = 1 },
+    { .x = 128, .y = 130, .z = 127, .voxel_id = 1 },
+    { .x = 128, .y = 113, .z = 128, .voxel_id = 1 },
+    { .x = 128, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 128, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 128, .y = 130, .z = 128, .voxel_id = 1 },
+    { .x = 128, .y = 113, .z = 129, .voxel_id = 1 },
+    { .x = 128, .y = 114, .z = 129, .voxel_id = 1 },
+    { .x = 128, .y = 115, .z = 129, .voxel_id = 1 },
+    { .x = 128, .y = 126, .z = 129, .voxel_id = 1 },
+    { .x = 128, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 128, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 128, .y = 114, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 115, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 116, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 117, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 118, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 119, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 120, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 121, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 122, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 124, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 125, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 126, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 128, .y = 120, .z = 131, .voxel_id = 1 },
+    { .x = 128, .y = 121, .z = 131, .voxel_id = 1 },
+    { .x = 128, .y = 122, .z = 131, .voxel_id = 1 },
+    { .x = 128, .y = 126, .z = 131, .voxel_id = 1 },
+    { .x = 128, .y = 127, .z = 131, .voxel_id = 1 },
+    { .x = 128, .y = 128, .z = 131, .voxel_id = 1 },
+    { .x = 128, .y = 129, .z = 131, .voxel_id = 1 },
+    { .x = 129, .y = 124, .z = 113, .voxel_id = 1 },
+    { .x = 129, .y = 127, .z = 113, .voxel_id = 1 },
+    { .x = 129, .y = 128, .z = 113, .voxel_id = 1 },
+    { .x = 129, .y = 129, .z = 113, .voxel_id = 1 },
+    { .x = 129, .y = 123, .z = 114, .voxel_id = 1 },
+    { .x = 129, .y = 124, .z = 114, .voxel_id = 1 },
+    { .x = 129, .y = 126, .z = 114, .voxel_id = 1 },
+    { .x = 129, .y = 127, .z = 114, .voxel_id = 1 },
+    { .x = 129, .y = 121, .z = 115, .voxel_id = 1 },
+    { .x = 129, .y = 131, .z = 115, .voxel_id = 1 },
+    { .x = 129, .y = 132, .z = 115, .voxel_id = 1 },
+    { .x = 129, .y = 121, .z = 116, .voxel_id = 1 },
+    { .x = 129, .y = 132, .z = 116, .voxel_id = 1 },
+    { .x = 129, .y = 133, .z = 116, .voxel_id = 1 },
+    { .x = 129, .y = 120, .z = 117, .voxel_id = 1 },
+    { .x = 129, .y = 121, .z = 117, .voxel_id = 1 },
+    { .x = 129, .y = 133, .z = 117, .voxel_id = 1 },
+    { .x = 129, .y = 119, .z = 118, .voxel_id = 1 },
+    { .x = 129, .y = 120, .z = 118, .voxel_id = 1 },
+    { .x = 129, .y = 119, .z = 119, .voxel_id = 1 },
+    { .x = 129, .y = 120, .z = 119, .voxel_id = 1 },
+    { .x = 129, .y = 119, .z = 120, .voxel_id = 1 },
+    { .x = 129, .y = 134, .z = 120, .voxel_id = 1 },
+    { .x = 129, .y = 119, .z = 121, .voxel_id = 1 },
+    { .x = 129, .y = 134, .z = 121, .voxel_id = 1 },
+    { .x = 129, .y = 119, .z = 122, .voxel_id = 1 },
+    { .x = 129, .y = 119, .z = 123, .voxel_id = 1 },
+    { .x = 129, .y = 133, .z = 123, .voxel_id = 1 },
+    { .x = 129, .y = 119, .z = 124, .voxel_id = 1 },
+    { .x = 129, .y = 133, .z = 124, .voxel_id = 1 },
+    { .x = 129, .y = 118, .z = 125, .voxel_id = 1 },
+    { .x = 129, .y = 119, .z = 125, .voxel_id = 1 },
+    { .x = 129, .y = 133, .z = 125, .voxel_id = 1 },
+    { .x = 129, .y = 114, .z = 126, .voxel_id = 1 },
+    { .x = 129, .y = 115, .z = 126, .voxel_id = 1 },
+    { .x = 129, .y = 116, .z = 126, .voxel_id = 1 },
+    { .x = 129, .y = 117, .z = 126, .voxel_id = 1 },
+    { .x = 129, .y = 118, .z = 126, .voxel_id = 1 },
+    { .x = 129, .y = 113, .z = 127, .voxel_id = 1 },
+    { .x = 129, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 129, .y = 130, .z = 127, .voxel_id = 1 },
+    { .x = 129, .y = 131, .z = 127, .voxel_id = 1 },
+    { .x = 129, .y = 113, .z = 128, .voxel_id = 1 },
+    { .x = 129, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 129, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 129, .y = 130, .z = 128, .voxel_id = 1 },
+    { .x = 129, .y = 113, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 114, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 115, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 120, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 121, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 122, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 125, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 126, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 127, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 130, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 131, .z = 129, .voxel_id = 1 },
+    { .x = 129, .y = 114, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 115, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 116, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 117, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 118, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 119, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 120, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 121, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 122, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 123, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 124, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 125, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 126, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 130, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 131, .z = 130, .voxel_id = 1 },
+    { .x = 129, .y = 121, .z = 131, .voxel_id = 1 },
+    { .x = 129, .y = 122, .z = 131, .voxel_id = 1 },
+    { .x = 129, .y = 123, .z = 131, .voxel_id = 1 },
+    { .x = 129, .y = 128, .z = 131, .voxel_id = 1 },
+    { .x = 129, .y = 129, .z = 131, .voxel_id = 1 },
+    { .x = 129, .y = 130, .z = 131, .voxel_id = 1 },
+    { .x = 129, .y = 131, .z = 131, .voxel_id = 1 },
+    { .x = 130, .y = 127, .z = 113, .voxel_id = 1 },
+    { .x = 130, .y = 128, .z = 113, .voxel_id = 1 },
+    { .x = 130, .y = 129, .z = 113, .voxel_id = 1 },
+    { .x = 130, .y = 123, .z = 114, .voxel_id = 1 },
+    { .x = 130, .y = 124, .z = 114, .voxel_id = 1 },
+    { .x = 130, .y = 125, .z = 114, .voxel_id = 1 },
+    { .x = 130, .y = 126, .z = 114, .voxel_id = 1 },
+    { .x = 130, .y = 127, .z = 114, .voxel_id = 1 },
+    { .x = 130, .y = 128, .z = 114, .voxel_id = 1 },
+    { .x = 130, .y = 121, .z = 115, .voxel_id = 1 },
+    { .x = 130, .y = 122, .z = 115, .voxel_id = 1 },
+    { .x = 130, .y = 123, .z = 115, .voxel_id = 1 },
+    { .x = 130, .y = 130, .z = 115, .voxel_id = 1 },
+    { .x = 130, .y = 131, .z = 115, .voxel_id = 1 },
+    { .x = 130, .y = 132, .z = 115, .voxel_id = 1 },
+    { .x = 130, .y = 121, .z = 116, .voxel_id = 1 },
+    { .x = 130, .y = 122, .z = 116, .voxel_id = 1 },
+    { .x = 130, .y = 131, .z = 116, .voxel_id = 1 },
+    { .x = 130, .y = 132, .z = 116, .voxel_id = 1 },
+    { .x = 130, .y = 133, .z = 116, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 117, .voxel_id = 1 },
+    { .x = 130, .y = 121, .z = 117, .voxel_id = 1 },
+    { .x = 130, .y = 132, .z = 117, .voxel_id = 1 },
+    { .x = 130, .y = 133, .z = 117, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 118, .voxel_id = 1 },
+    { .x = 130, .y = 121, .z = 118, .voxel_id = 1 },
+    { .x = 130, .y = 119, .z = 119, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 119, .voxel_id = 1 },
+    { .x = 130, .y = 133, .z = 119, .voxel_id = 1 },
+    { .x = 130, .y = 134, .z = 119, .voxel_id = 1 },
+    { .x = 130, .y = 119, .z = 120, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 120, .voxel_id = 1 },
+    { .x = 130, .y = 133, .z = 120, .voxel_id = 1 },
+    { .x = 130, .y = 134, .z = 120, .voxel_id = 1 },
+    { .x = 130, .y = 119, .z = 121, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 121, .voxel_id = 1 },
+    { .x = 130, .y = 134, .z = 121, .voxel_id = 1 },
+    { .x = 130, .y = 119, .z = 122, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 122, .voxel_id = 1 },
+    { .x = 130, .y = 119, .z = 123, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 123, .voxel_id = 1 },
+    { .x = 130, .y = 133, .z = 123, .voxel_id = 1 },
+    { .x = 130, .y = 119, .z = 124, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 124, .voxel_id = 1 },
+    { .x = 130, .y = 133, .z = 124, .voxel_id = 1 },
+    { .x = 130, .y = 119, .z = 125, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 125, .voxel_id = 1 },
+    { .x = 130, .y = 121, .z = 125, .voxel_id = 1 },
+    { .x = 130, .y = 133, .z = 125, .voxel_id = 1 },
+    { .x = 130, .y = 113, .z = 126, .voxel_id = 1 },
+    { .x = 130, .y = 114, .z = 126, .voxel_id = 1 },
+    { .x = 130, .y = 115, .z = 126, .voxel_id = 1 },
+    { .x = 130, .y = 116, .z = 126, .voxel_id = 1 },
+    { .x = 130, .y = 117, .z = 126, .voxel_id = 1 },
+    { .x = 130, .y = 118, .z = 126, .voxel_id = 1 },
+    { .x = 130, .y = 119, .z = 126, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 126, .voxel_id = 1 },
+    { .x = 130, .y = 121, .z = 126, .voxel_id = 1 },
+    { .x = 130, .y = 130, .z = 126, .voxel_id = 1 },
+    { .x = 130, .y = 131, .z = 126, .voxel_id = 1 },
+    { .x = 130, .y = 113, .z = 127, .voxel_id = 1 },
+    { .x = 130, .y = 114, .z = 127, .voxel_id = 1 },
+    { .x = 130, .y = 117, .z = 127, .voxel_id = 1 },
+    { .x = 130, .y = 118, .z = 127, .voxel_id = 1 },
+    { .x = 130, .y = 119, .z = 127, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 127, .voxel_id = 1 },
+    { .x = 130, .y = 121, .z = 127, .voxel_id = 1 },
+    { .x = 130, .y = 122, .z = 127, .voxel_id = 1 },
+    { .x = 130, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 130, .y = 130, .z = 127, .voxel_id = 1 },
+    { .x = 130, .y = 131, .z = 127, .voxel_id = 1 },
+    { .x = 130, .y = 113, .z = 128, .voxel_id = 1 },
+    { .x = 130, .y = 119, .z = 128, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 128, .voxel_id = 1 },
+    { .x = 130, .y = 121, .z = 128, .voxel_id = 1 },
+    { .x = 130, .y = 122, .z = 128, .voxel_id = 1 },
+    { .x = 130, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 130, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 130, .y = 130, .z = 128, .voxel_id = 1 },
+    { .x = 130, .y = 131, .z = 128, .voxel_id = 1 },
+    { .x = 130, .y = 113, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 114, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 115, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 116, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 117, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 118, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 119, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 121, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 130, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 131, .z = 129, .voxel_id = 1 },
+    { .x = 130, .y = 115, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 116, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 117, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 118, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 119, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 120, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 122, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 123, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 124, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 125, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 126, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 131, .z = 130, .voxel_id = 1 },
+    { .x = 130, .y = 125, .z = 131, .voxel_id = 1 },
+    { .x = 130, .y = 126, .z = 131, .voxel_id = 1 },
+    { .x = 130, .y = 127, .z = 131, .voxel_id = 1 },
+    { .x = 130, .y = 128, .z = 131, .voxel_id = 1 },
+    { .x = 130, .y = 129, .z = 131, .voxel_id = 1 },
+    { .x = 130, .y = 130, .z = 131, .voxel_id = 1 },
+    { .x = 130, .y = 131, .z = 131, .voxel_id = 1 },
+    { .x = 131, .y = 128, .z = 113, .voxel_id = 1 },
+    { .x = 131, .y = 129, .z = 113, .voxel_id = 1 },
+    { .x = 131, .y = 123, .z = 114, .voxel_id = 1 },
+    { .x = 131, .y = 124, .z = 114, .voxel_id = 1 },
+    { .x = 131, .y = 125, .z = 114, .voxel_id = 1 },
+    { .x = 131, .y = 126, .z = 114, .voxel_id = 1 },
+    { .x = 131, .y = 127, .z = 114, .voxel_id = 1 },
+    { .x = 131, .y = 128, .z = 114, .voxel_id = 1 },
+    { .x = 131, .y = 129, .z = 114, .voxel_id = 1 },
+    { .x = 131, .y = 122, .z = 115, .voxel_id = 1 },
+    { .x = 131, .y = 123, .z = 115, .voxel_id = 1 },
+    { .x = 131, .y = 124, .z = 115, .voxel_id = 1 },
+    { .x = 131, .y = 129, .z = 115, .voxel_id = 1 },
+    { .x = 131, .y = 130, .z = 115, .voxel_id = 1 },
+    { .x = 131, .y = 131, .z = 115, .voxel_id = 1 },
+    { .x = 131, .y = 121, .z = 116, .voxel_id = 1 },
+    { .x = 131, .y = 122, .z = 116, .voxel_id = 1 },
+    { .x = 131, .y = 123, .z = 116, .voxel_id = 1 },
+    { .x = 131, .y = 131, .z = 116, .voxel_id = 1 },
+    { .x = 131, .y = 132, .z = 116, .voxel_id = 1 },
+    { .x = 131, .y = 121, .z = 117, .voxel_id = 1 },
+    { .x = 131, .y = 122, .z = 117, .voxel_id = 1 },
+    { .x = 131, .y = 132, .z = 117, .voxel_id = 1 },
+    { .x = 131, .y = 133, .z = 117, .voxel_id = 1 },
+    { .x = 131, .y = 120, .z = 118, .voxel_id = 1 },
+    { .x = 131, .y = 121, .z = 118, .voxel_id = 1 },
+    { .x = 131, .y = 133, .z = 118, .voxel_id = 1 },
+    { .x = 131, .y = 120, .z = 119, .voxel_id = 1 },
+    { .x = 131, .y = 121, .z = 119, .voxel_id = 1 },
+    { .x = 131, .y = 133, .z = 119, .voxel_id = 1 },
+    { .x = 131, .y = 120, .z = 120, .voxel_id = 1 },
+    { .x = 131, .y = 121, .z = 120, .voxel_id = 1 },
+    { .x = 131, .y = 133, .z = 120, .voxel_id = 1 },
+    { .x = 131, .y = 134, .z = 120, .voxel_id = 1 },
+    { .x = 131, .y = 120, .z = 121, .voxel_id = 1 },
+    { .x = 131, .y = 121, .z = 121, .voxel_id = 1 },
+    { .x = 131, .y = 134, .z = 121, .voxel_id = 1 },
+    { .x = 131, .y = 120, .z = 122, .voxel_id = 1 },
+    { .x = 131, .y = 133, .z = 122, .voxel_id = 1 },
+    { .x = 131, .y = 133, .z = 123, .voxel_id = 1 },
+    { .x = 131, .y = 120, .z = 124, .voxel_id = 1 },
+    { .x = 131, .y = 121, .z = 124, .voxel_id = 1 },
+    { .x = 131, .y = 133, .z = 124, .voxel_id = 1 },
+    { .x = 131, .y = 120, .z = 125, .voxel_id = 1 },
+    { .x = 131, .y = 121, .z = 125, .voxel_id = 1 },
+    { .x = 131, .y = 131, .z = 125, .voxel_id = 1 },
+    { .x = 131, .y = 132, .z = 125, .voxel_id = 1 },
+    { .x = 131, .y = 133, .z = 125, .voxel_id = 1 },
+    { .x = 131, .y = 113, .z = 126, .voxel_id = 1 },
+    { .x = 131, .y = 114, .z = 126, .voxel_id = 1 },
+    { .x = 131, .y = 115, .z = 126, .voxel_id = 1 },
+    { .x = 131, .y = 116, .z = 126, .voxel_id = 1 },
+    { .x = 131, .y = 121, .z = 126, .voxel_id = 1 },
+    { .x = 131, .y = 130, .z = 126, .voxel_id = 1 },
+    { .x = 131, .y = 131, .z = 126, .voxel_id = 1 },
+    { .x = 131, .y = 132, .z = 126, .voxel_id = 1 },
+    { .x = 131, .y = 113, .z = 127, .voxel_id = 1 },
+    { .x = 131, .y = 114, .z = 127, .voxel_id = 1 },
+    { .x = 131, .y = 115, .z = 127, .voxel_id = 1 },
+    { .x = 131, .y = 116, .z = 127, .voxel_id = 1 },
+    { .x = 131, .y = 117, .z = 127, .voxel_id = 1 },
+    { .x = 131, .y = 118, .z = 127, .voxel_id = 1 },
+    { .x = 131, .y = 119, .z = 127, .voxel_id = 1 },
+    { .x = 131, .y = 121, .z = 127, .voxel_id = 1 },
+    { .x = 131, .y = 122, .z = 127, .voxel_id = 1 },
+    { .x = 131, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 131, .y = 130, .z = 127, .voxel_id = 1 },
+    { .x = 131, .y = 113, .z = 128, .voxel_id = 1 },
+    { .x = 131, .y = 114, .z = 128, .voxel_id = 1 },
+    { .x = 131, .y = 115, .z = 128, .voxel_id = 1 },
+    { .x = 131, .y = 116, .z = 128, .voxel_id = 1 },
+    { .x = 131, .y = 117, .z = 128, .voxel_id = 1 },
+    { .x = 131, .y = 118, .z = 128, .voxel_id = 1 },
+    { .x = 131, .y = 119, .z = 128, .voxel_id = 1 },
+    { .x = 131, .y = 121, .z = 128, .voxel_id = 1 },
+    { .x = 131, .y = 122, .z = 128, .voxel_id = 1 },
+    { .x = 131, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 131, .y = 130, .z = 128, .voxel_id = 1 },
+    { .x = 131, .y = 131, .z = 128, .voxel_id = 1 },
+    { .x = 131, .y = 113, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 114, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 115, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 116, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 117, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 118, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 119, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 122, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 123, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 131, .z = 129, .voxel_id = 1 },
+    { .x = 131, .y = 123, .z = 130, .voxel_id = 1 },
+    { .x = 131, .y = 124, .z = 130, .voxel_id = 1 },
+    { .x = 131, .y = 125, .z = 130, .voxel_id = 1 },
+    { .x = 131, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 131, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 131, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 131, .y = 130, .z = 130, .voxel_id = 1 },
+    { .x = 131, .y = 131, .z = 130, .voxel_id = 1 },
+    { .x = 131, .y = 132, .z = 130, .voxel_id = 1 },
+    { .x = 131, .y = 125, .z = 131, .voxel_id = 1 },
+    { .x = 131, .y = 126, .z = 131, .voxel_id = 1 },
+    { .x = 131, .y = 127, .z = 131, .voxel_id = 1 },
+    { .x = 131, .y = 129, .z = 131, .voxel_id = 1 },
+    { .x = 131, .y = 130, .z = 131, .voxel_id = 1 },
+    { .x = 131, .y = 131, .z = 131, .voxel_id = 1 },
+    { .x = 132, .y = 125, .z = 114, .voxel_id = 1 },
+    { .x = 132, .y = 126, .z = 114, .voxel_id = 1 },
+    { .x = 132, .y = 127, .z = 114, .voxel_id = 1 },
+    { .x = 132, .y = 128, .z = 114, .voxel_id = 1 },
+    { .x = 132, .y = 129, .z = 114, .voxel_id = 1 },
+    { .x = 132, .y = 123, .z = 115, .voxel_id = 1 },
+    { .x = 132, .y = 124, .z = 115, .voxel_id = 1 },
+    { .x = 132, .y = 129, .z = 115, .voxel_id = 1 },
+    { .x = 132, .y = 130, .z = 115, .voxel_id = 1 },
+    { .x = 132, .y = 131, .z = 115, .voxel_id = 1 },
+    { .x = 132, .y = 122, .z = 116, .voxel_id = 1 },
+    { .x = 132, .y = 123, .z = 116, .voxel_id = 1 },
+    { .x = 132, .y = 124, .z = 116, .voxel_id = 1 },
+    { .x = 132, .y = 130, .z = 116, .voxel_id = 1 },
+    { .x = 132, .y = 131, .z = 116, .voxel_id = 1 },
+    { .x = 132, .y = 132, .z = 116, .voxel_id = 1 },
+    { .x = 132, .y = 121, .z = 117, .voxel_id = 1 },
+    { .x = 132, .y = 122, .z = 117, .voxel_id = 1 },
+    { .x = 132, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 132, .y = 131, .z = 117, .voxel_id = 1 },
+    { .x = 132, .y = 132, .z = 117, .voxel_id = 1 },
+    { .x = 132, .y = 133, .z = 117, .voxel_id = 1 },
+    { .x = 132, .y = 121, .z = 118, .voxel_id = 1 },
+    { .x = 132, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 132, .y = 133, .z = 118, .voxel_id = 1 },
+    { .x = 132, .y = 121, .z = 119, .voxel_id = 1 },
+    { .x = 132, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 132, .y = 133, .z = 119, .voxel_id = 1 },
+    { .x = 132, .y = 121, .z = 120, .voxel_id = 1 },
+    { .x = 132, .y = 133, .z = 120, .voxel_id = 1 },
+    { .x = 132, .y = 134, .z = 120, .voxel_id = 1 },
+    { .x = 132, .y = 121, .z = 121, .voxel_id = 1 },
+    { .x = 132, .y = 133, .z = 121, .voxel_id = 1 },
+    { .x = 132, .y = 134, .z = 121, .voxel_id = 1 },
+    { .x = 132, .y = 121, .z = 122, .voxel_id = 1 },
+    { .x = 132, .y = 122, .z = 122, .voxel_id = 1 },
+    { .x = 132, .y = 133, .z = 122, .voxel_id = 1 },
+    { .x = 132, .y = 121, .z = 123, .voxel_id = 1 },
+    { .x = 132, .y = 122, .z = 123, .voxel_id = 1 },
+    { .x = 132, .y = 133, .z = 123, .voxel_id = 1 },
+    { .x = 132, .y = 121, .z = 124, .voxel_id = 1 },
+    { .x = 132, .y = 122, .z = 124, .voxel_id = 1 },
+    { .x = 132, .y = 132, .z = 124, .voxel_id = 1 },
+    { .x = 132, .y = 133, .z = 124, .voxel_id = 1 },
+    { .x = 132, .y = 122, .z = 125, .voxel_id = 1 },
+    { .x = 132, .y = 131, .z = 125, .voxel_id = 1 },
+    { .x = 132, .y = 132, .z = 125, .voxel_id = 1 },
+    { .x = 132, .y = 133, .z = 125, .voxel_id = 1 },
+    { .x = 132, .y = 122, .z = 126, .voxel_id = 1 },
+    { .x = 132, .y = 129, .z = 126, .voxel_id = 1 },
+    { .x = 132, .y = 130, .z = 126, .voxel_id = 1 },
+    { .x = 132, .y = 131, .z = 126, .voxel_id = 1 },
+    { .x = 132, .y = 122, .z = 127, .voxel_id = 1 },
+    { .x = 132, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 132, .y = 130, .z = 127, .voxel_id = 1 },
+    { .x = 132, .y = 113, .z = 128, .voxel_id = 1 },
+    { .x = 132, .y = 114, .z = 128, .voxel_id = 1 },
+    { .x = 132, .y = 122, .z = 128, .voxel_id = 1 },
+    { .x = 132, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 132, .y = 130, .z = 128, .voxel_id = 1 },
+    { .x = 132, .y = 122, .z = 129, .voxel_id = 1 },
+    { .x = 132, .y = 123, .z = 129, .voxel_id = 1 },
+    { .x = 132, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 132, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 132, .y = 130, .z = 129, .voxel_id = 1 },
+    { .x = 132, .y = 131, .z = 129, .voxel_id = 1 },
+    { .x = 132, .y = 123, .z = 130, .voxel_id = 1 },
+    { .x = 132, .y = 124, .z = 130, .voxel_id = 1 },
+    { .x = 132, .y = 125, .z = 130, .voxel_id = 1 },
+    { .x = 132, .y = 126, .z = 130, .voxel_id = 1 },
+    { .x = 132, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 132, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 132, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 132, .y = 130, .z = 130, .voxel_id = 1 },
+    { .x = 132, .y = 131, .z = 130, .voxel_id = 1 },
+    { .x = 132, .y = 125, .z = 131, .voxel_id = 1 },
+    { .x = 132, .y = 126, .z = 131, .voxel_id = 1 },
+    { .x = 132, .y = 127, .z = 131, .voxel_id = 1 },
+    { .x = 132, .y = 129, .z = 131, .voxel_id = 1 },
+    { .x = 132, .y = 130, .z = 131, .voxel_id = 1 },
+    { .x = 133, .y = 127, .z = 114, .voxel_id = 1 },
+    { .x = 133, .y = 128, .z = 114, .voxel_id = 1 },
+    { .x = 133, .y = 129, .z = 114, .voxel_id = 1 },
+    { .x = 133, .y = 124, .z = 115, .voxel_id = 1 },
+    { .x = 133, .y = 125, .z = 115, .voxel_id = 1 },
+    { .x = 133, .y = 126, .z = 115, .voxel_id = 1 },
+    { .x = 133, .y = 127, .z = 115, .voxel_id = 1 },
+    { .x = 133, .y = 128, .z = 115, .voxel_id = 1 },
+    { .x = 133, .y = 129, .z = 115, .voxel_id = 1 },
+    { .x = 133, .y = 130, .z = 115, .voxel_id = 1 },
+    { .x = 133, .y = 123, .z = 116, .voxel_id = 1 },
+    { .x = 133, .y = 124, .z = 116, .voxel_id = 1 },
+    { .x = 133, .y = 125, .z = 116, .voxel_id = 1 },
+    { .x = 133, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 133, .y = 129, .z = 116, .voxel_id = 1 },
+    { .x = 133, .y = 130, .z = 116, .voxel_id = 1 },
+    { .x = 133, .y = 131, .z = 116, .voxel_id = 1 },
+    { .x = 133, .y = 122, .z = 117, .voxel_id = 1 },
+    { .x = 133, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 133, .y = 131, .z = 117, .voxel_id = 1 },
+    { .x = 133, .y = 132, .z = 117, .voxel_id = 1 },
+    { .x = 133, .y = 133, .z = 117, .voxel_id = 1 },
+    { .x = 133, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 133, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 133, .y = 132, .z = 118, .voxel_id = 1 },
+    { .x = 133, .y = 133, .z = 118, .voxel_id = 1 },
+    { .x = 133, .y = 121, .z = 119, .voxel_id = 1 },
+    { .x = 133, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 133, .y = 132, .z = 119, .voxel_id = 1 },
+    { .x = 133, .y = 133, .z = 119, .voxel_id = 1 },
+    { .x = 133, .y = 121, .z = 120, .voxel_id = 1 },
+    { .x = 133, .y = 122, .z = 120, .voxel_id = 1 },
+    { .x = 133, .y = 132, .z = 120, .voxel_id = 1 },
+    { .x = 133, .y = 133, .z = 120, .voxel_id = 1 },
+    { .x = 133, .y = 121, .z = 121, .voxel_id = 1 },
+    { .x = 133, .y = 122, .z = 121, .voxel_id = 1 },
+    { .x = 133, .y = 133, .z = 121, .voxel_id = 1 },
+    { .x = 133, .y = 121, .z = 122, .voxel_id = 1 },
+    { .x = 133, .y = 122, .z = 122, .voxel_id = 1 },
+    { .x = 133, .y = 132, .z = 122, .voxel_id = 1 },
+    { .x = 133, .y = 133, .z = 122, .voxel_id = 1 },
+    { .x = 133, .y = 122, .z = 123, .voxel_id = 1 },
+    { .x = 133, .y = 132, .z = 123, .voxel_id = 1 },
+    { .x = 133, .y = 133, .z = 123, .voxel_id = 1 },
+    { .x = 133, .y = 122, .z = 124, .voxel_id = 1 },
+    { .x = 133, .y = 132, .z = 124, .voxel_id = 1 },
+    { .x = 133, .y = 133, .z = 124, .voxel_id = 1 },
+    { .x = 133, .y = 122, .z = 125, .voxel_id = 1 },
+    { .x = 133, .y = 123, .z = 125, .voxel_id = 1 },
+    { .x = 133, .y = 129, .z = 125, .voxel_id = 1 },
+    { .x = 133, .y = 130, .z = 125, .voxel_id = 1 },
+    { .x = 133, .y = 131, .z = 125, .voxel_id = 1 },
+    { .x = 133, .y = 132, .z = 125, .voxel_id = 1 },
+    { .x = 133, .y = 122, .z = 126, .voxel_id = 1 },
+    { .x = 133, .y = 123, .z = 126, .voxel_id = 1 },
+    { .x = 133, .y = 129, .z = 126, .voxel_id = 1 },
+    { .x = 133, .y = 130, .z = 126, .voxel_id = 1 },
+    { .x = 133, .y = 131, .z = 126, .voxel_id = 1 },
+    { .x = 133, .y = 122, .z = 127, .voxel_id = 1 },
+    { .x = 133, .y = 123, .z = 127, .voxel_id = 1 },
+    { .x = 133, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 133, .y = 122, .z = 128, .voxel_id = 1 },
+    { .x = 133, .y = 123, .z = 128, .voxel_id = 1 },
+    { .x = 133, .y = 124, .z = 128, .voxel_id = 1 },
+    { .x = 133, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 133, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 133, .y = 130, .z = 128, .voxel_id = 1 },
+    { .x = 133, .y = 123, .z = 129, .voxel_id = 1 },
+    { .x = 133, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 133, .y = 125, .z = 129, .voxel_id = 1 },
+    { .x = 133, .y = 126, .z = 129, .voxel_id = 1 },
+    { .x = 133, .y = 127, .z = 129, .voxel_id = 1 },
+    { .x = 133, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 133, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 133, .y = 130, .z = 129, .voxel_id = 1 },
+    { .x = 133, .y = 124, .z = 130, .voxel_id = 1 },
+    { .x = 133, .y = 125, .z = 130, .voxel_id = 1 },
+    { .x = 133, .y = 126, .z = 130, .voxel_id = 1 },
+    { .x = 133, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 133, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 133, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 133, .y = 130, .z = 130, .voxel_id = 1 },
+    { .x = 133, .y = 129, .z = 131, .voxel_id = 1 },
+    { .x = 134, .y = 126, .z = 115, .voxel_id = 1 },
+    { .x = 134, .y = 127, .z = 115, .voxel_id = 1 },
+    { .x = 134, .y = 129, .z = 115, .voxel_id = 1 },
+    { .x = 134, .y = 123, .z = 116, .voxel_id = 1 },
+    { .x = 134, .y = 124, .z = 116, .voxel_id = 1 },
+    { .x = 134, .y = 125, .z = 116, .voxel_id = 1 },
+    { .x = 134, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 134, .y = 127, .z = 116, .voxel_id = 1 },
+    { .x = 134, .y = 128, .z = 116, .voxel_id = 1 },
+    { .x = 134, .y = 129, .z = 116, .voxel_id = 1 },
+    { .x = 134, .y = 130, .z = 116, .voxel_id = 1 },
+    { .x = 134, .y = 131, .z = 116, .voxel_id = 1 },
+    { .x = 134, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 134, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 134, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 134, .y = 129, .z = 117, .voxel_id = 1 },
+    { .x = 134, .y = 130, .z = 117, .voxel_id = 1 },
+    { .x = 134, .y = 131, .z = 117, .voxel_id = 1 },
+    { .x = 134, .y = 132, .z = 117, .voxel_id = 1 },
+    { .x = 134, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 134, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 134, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 134, .y = 123, .z = 119, .voxel_id = 1 },
+    { .x = 134, .y = 132, .z = 119, .voxel_id = 1 },
+    { .x = 134, .y = 122, .z = 120, .voxel_id = 1 },
+    { .x = 134, .y = 132, .z = 120, .voxel_id = 1 },
+    { .x = 134, .y = 133, .z = 120, .voxel_id = 1 },
+    { .x = 134, .y = 122, .z = 121, .voxel_id = 1 },
+    { .x = 134, .y = 122, .z = 122, .voxel_id = 1 },
+    { .x = 134, .y = 131, .z = 122, .voxel_id = 1 },
+    { .x = 134, .y = 132, .z = 122, .voxel_id = 1 },
+    { .x = 134, .y = 122, .z = 123, .voxel_id = 1 },
+    { .x = 134, .y = 131, .z = 123, .voxel_id = 1 },
+    { .x = 134, .y = 132, .z = 123, .voxel_id = 1 },
+    { .x = 134, .y = 123, .z = 125, .voxel_id = 1 },
+    { .x = 134, .y = 128, .z = 125, .voxel_id = 1 },
+    { .x = 134, .y = 129, .z = 125, .voxel_id = 1 },
+    { .x = 134, .y = 130, .z = 125, .voxel_id = 1 },
+    { .x = 134, .y = 123, .z = 126, .voxel_id = 1 },
+    { .x = 134, .y = 124, .z = 126, .voxel_id = 1 },
+    { .x = 134, .y = 128, .z = 126, .voxel_id = 1 },
+    { .x = 134, .y = 129, .z = 126, .voxel_id = 1 },
+    { .x = 134, .y = 123, .z = 127, .voxel_id = 1 },
+    { .x = 134, .y = 124, .z = 127, .voxel_id = 1 },
+    { .x = 134, .y = 128, .z = 127, .voxel_id = 1 },
+    { .x = 134, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 134, .y = 122, .z = 128, .voxel_id = 1 },
+    { .x = 134, .y = 123, .z = 128, .voxel_id = 1 },
+    { .x = 134, .y = 124, .z = 128, .voxel_id = 1 },
+    { .x = 134, .y = 125, .z = 128, .voxel_id = 1 },
+    { .x = 134, .y = 126, .z = 128, .voxel_id = 1 },
+    { .x = 134, .y = 127, .z = 128, .voxel_id = 1 },
+    { .x = 134, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 134, .y = 123, .z = 129, .voxel_id = 1 },
+    { .x = 134, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 134, .y = 125, .z = 129, .voxel_id = 1 },
+    { .x = 134, .y = 126, .z = 129, .voxel_id = 1 },
+    { .x = 134, .y = 127, .z = 129, .voxel_id = 1 },
+    { .x = 134, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 134, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 134, .y = 130, .z = 129, .voxel_id = 1 },
+    { .x = 134, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 134, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 134, .y = 129, .z = 130, .voxel_id = 1 },
+    { .x = 135, .y = 125, .z = 116, .voxel_id = 1 },
+    { .x = 135, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 135, .y = 127, .z = 116, .voxel_id = 1 },
+    { .x = 135, .y = 128, .z = 116, .voxel_id = 1 },
+    { .x = 135, .y = 129, .z = 116, .voxel_id = 1 },
+    { .x = 135, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 135, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 135, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 135, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 135, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 135, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 135, .y = 129, .z = 117, .voxel_id = 1 },
+    { .x = 135, .y = 130, .z = 117, .voxel_id = 1 },
+    { .x = 135, .y = 131, .z = 117, .voxel_id = 1 },
+    { .x = 135, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 135, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 135, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 135, .y = 123, .z = 119, .voxel_id = 1 },
+    { .x = 135, .y = 130, .z = 119, .voxel_id = 1 },
+    { .x = 135, .y = 131, .z = 119, .voxel_id = 1 },
+    { .x = 135, .y = 122, .z = 120, .voxel_id = 1 },
+    { .x = 135, .y = 123, .z = 120, .voxel_id = 1 },
+    { .x = 135, .y = 124, .z = 120, .voxel_id = 1 },
+    { .x = 135, .y = 130, .z = 120, .voxel_id = 1 },
+    { .x = 135, .y = 131, .z = 120, .voxel_id = 1 },
+    { .x = 135, .y = 132, .z = 120, .voxel_id = 1 },
+    { .x = 135, .y = 122, .z = 121, .voxel_id = 1 },
+    { .x = 135, .y = 123, .z = 121, .voxel_id = 1 },
+    { .x = 135, .y = 124, .z = 121, .voxel_id = 1 },
+    { .x = 135, .y = 130, .z = 121, .voxel_id = 1 },
+    { .x = 135, .y = 131, .z = 121, .voxel_id = 1 },
+    { .x = 135, .y = 122, .z = 122, .voxel_id = 1 },
+    { .x = 135, .y = 123, .z = 122, .voxel_id = 1 },
+    { .x = 135, .y = 130, .z = 122, .voxel_id = 1 },
+    { .x = 135, .y = 131, .z = 122, .voxel_id = 1 },
+    { .x = 135, .y = 122, .z = 123, .voxel_id = 1 },
+    { .x = 135, .y = 123, .z = 123, .voxel_id = 1 },
+    { .x = 135, .y = 130, .z = 123, .voxel_id = 1 },
+    { .x = 135, .y = 131, .z = 123, .voxel_id = 1 },
+    { .x = 135, .y = 123, .z = 124, .voxel_id = 1 },
+    { .x = 135, .y = 124, .z = 124, .voxel_id = 1 },
+    { .x = 135, .y = 129, .z = 124, .voxel_id = 1 },
+    { .x = 135, .y = 123, .z = 125, .voxel_id = 1 },
+    { .x = 135, .y = 124, .z = 125, .voxel_id = 1 },
+    { .x = 135, .y = 128, .z = 125, .voxel_id = 1 },
+    { .x = 135, .y = 129, .z = 125, .voxel_id = 1 },
+    { .x = 135, .y = 123, .z = 126, .voxel_id = 1 },
+    { .x = 135, .y = 124, .z = 126, .voxel_id = 1 },
+    { .x = 135, .y = 125, .z = 126, .voxel_id = 1 },
+    { .x = 135, .y = 128, .z = 126, .voxel_id = 1 },
+    { .x = 135, .y = 123, .z = 127, .voxel_id = 1 },
+    { .x = 135, .y = 124, .z = 127, .voxel_id = 1 },
+    { .x = 135, .y = 128, .z = 127, .voxel_id = 1 },
+    { .x = 135, .y = 129, .z = 127, .voxel_id = 1 },
+    { .x = 135, .y = 123, .z = 128, .voxel_id = 1 },
+    { .x = 135, .y = 124, .z = 128, .voxel_id = 1 },
+    { .x = 135, .y = 125, .z = 128, .voxel_id = 1 },
+    { .x = 135, .y = 126, .z = 128, .voxel_id = 1 },
+    { .x = 135, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 135, .y = 129, .z = 128, .voxel_id = 1 },
+    { .x = 135, .y = 124, .z = 129, .voxel_id = 1 },
+    { .x = 135, .y = 125, .z = 129, .voxel_id = 1 },
+    { .x = 135, .y = 126, .z = 129, .voxel_id = 1 },
+    { .x = 135, .y = 127, .z = 129, .voxel_id = 1 },
+    { .x = 135, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 135, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 135, .y = 127, .z = 130, .voxel_id = 1 },
+    { .x = 135, .y = 128, .z = 130, .voxel_id = 1 },
+    { .x = 136, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 136, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 136, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 136, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 136, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 136, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 136, .y = 124, .z = 118, .voxel_id = 1 },
+    { .x = 136, .y = 125, .z = 118, .voxel_id = 1 },
+    { .x = 136, .y = 126, .z = 118, .voxel_id = 1 },
+    { .x = 136, .y = 127, .z = 118, .voxel_id = 1 },
+    { .x = 136, .y = 128, .z = 118, .voxel_id = 1 },
+    { .x = 136, .y = 129, .z = 118, .voxel_id = 1 },
+    { .x = 136, .y = 130, .z = 118, .voxel_id = 1 },
+    { .x = 136, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 136, .y = 123, .z = 119, .voxel_id = 1 },
+    { .x = 136, .y = 124, .z = 119, .voxel_id = 1 },
+    { .x = 136, .y = 125, .z = 119, .voxel_id = 1 },
+    { .x = 136, .y = 126, .z = 119, .voxel_id = 1 },
+    { .x = 136, .y = 127, .z = 119, .voxel_id = 1 },
+    { .x = 136, .y = 128, .z = 119, .voxel_id = 1 },
+    { .x = 136, .y = 129, .z = 119, .voxel_id = 1 },
+    { .x = 136, .y = 130, .z = 119, .voxel_id = 1 },
+    { .x = 136, .y = 122, .z = 120, .voxel_id = 1 },
+    { .x = 136, .y = 123, .z = 120, .voxel_id = 1 },
+    { .x = 136, .y = 124, .z = 120, .voxel_id = 1 },
+    { .x = 136, .y = 125, .z = 120, .voxel_id = 1 },
+    { .x = 136, .y = 126, .z = 120, .voxel_id = 1 },
+    { .x = 136, .y = 127, .z = 120, .voxel_id = 1 },
+    { .x = 136, .y = 128, .z = 120, .voxel_id = 1 },
+    { .x = 136, .y = 129, .z = 120, .voxel_id = 1 },
+    { .x = 136, .y = 130, .z = 120, .voxel_id = 1 },
+    { .x = 136, .y = 131, .z = 120, .voxel_id = 1 },
+    { .x = 136, .y = 123, .z = 121, .voxel_id = 1 },
+    { .x = 136, .y = 124, .z = 121, .voxel_id = 1 },
+    { .x = 136, .y = 125, .z = 121, .voxel_id = 1 },
+    { .x = 136, .y = 126, .z = 121, .voxel_id = 1 },
+    { .x = 136, .y = 128, .z = 121, .voxel_id = 1 },
+    { .x = 136, .y = 129, .z = 121, .voxel_id = 1 },
+    { .x = 136, .y = 130, .z = 121, .voxel_id = 1 },
+    { .x = 136, .y = 123, .z = 122, .voxel_id = 1 },
+    { .x = 136, .y = 124, .z = 122, .voxel_id = 1 },
+    { .x = 136, .y = 125, .z = 122, .voxel_id = 1 },
+    { .x = 136, .y = 130, .z = 122, .voxel_id = 1 },
+    { .x = 136, .y = 123, .z = 123, .voxel_id = 1 },
+    { .x = 136, .y = 124, .z = 123, .voxel_id = 1 },
+    { .x = 136, .y = 125, .z = 123, .voxel_id = 1 },
+    { .x = 136, .y = 128, .z = 123, .voxel_id = 1 },
+    { .x = 136, .y = 129, .z = 123, .voxel_id = 1 },
+    { .x = 136, .y = 130, .z = 123, .voxel_id = 1 },
+    { .x = 136, .y = 123, .z = 124, .voxel_id = 1 },
+    { .x = 136, .y = 124, .z = 124, .voxel_id = 1 },
+    { .x = 136, .y = 125, .z = 124, .voxel_id = 1 },
+    { .x = 136, .y = 126, .z = 124, .voxel_id = 1 },
+    { .x = 136, .y = 129, .z = 124, .voxel_id = 1 },
+    { .x = 136, .y = 124, .z = 125, .voxel_id = 1 },
+    { .x = 136, .y = 125, .z = 125, .voxel_id = 1 },
+    { .x = 136, .y = 126, .z = 125, .voxel_id = 1 },
+    { .x = 136, .y = 127, .z = 125, .voxel_id = 1 },
+    { .x = 136, .y = 128, .z = 125, .voxel_id = 1 },
+    { .x = 136, .y = 129, .z = 125, .voxel_id = 1 },
+    { .x = 136, .y = 124, .z = 126, .voxel_id = 1 },
+    { .x = 136, .y = 125, .z = 126, .voxel_id = 1 },
+    { .x = 136, .y = 126, .z = 126, .voxel_id = 1 },
+    { .x = 136, .y = 127, .z = 126, .voxel_id = 1 },
+    { .x = 136, .y = 128, .z = 126, .voxel_id = 1 },
+    { .x = 136, .y = 124, .z = 127, .voxel_id = 1 },
+    { .x = 136, .y = 125, .z = 127, .voxel_id = 1 },
+    { .x = 136, .y = 126, .z = 127, .voxel_id = 1 },
+    { .x = 136, .y = 127, .z = 127, .voxel_id = 1 },
+    { .x = 136, .y = 128, .z = 127, .voxel_id = 1 },
+    { .x = 136, .y = 124, .z = 128, .voxel_id = 1 },
+    { .x = 136, .y = 125, .z = 128, .voxel_id = 1 },
+    { .x = 136, .y = 126, .z = 128, .voxel_id = 1 },
+    { .x = 136, .y = 127, .z = 128, .voxel_id = 1 },
+    { .x = 136, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 136, .y = 126, .z = 129, .voxel_id = 1 },
+    { .x = 136, .y = 127, .z = 129, .voxel_id = 1 },
+    { .x = 136, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 136, .y = 129, .z = 129, .voxel_id = 1 },
+    { .x = 137, .y = 122, .z = 117, .voxel_id = 1 },
+    { .x = 137, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 137, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 137, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 137, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 137, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 137, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 137, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 137, .y = 124, .z = 118, .voxel_id = 1 },
+    { .x = 137, .y = 125, .z = 118, .voxel_id = 1 },
+    { .x = 137, .y = 126, .z = 118, .voxel_id = 1 },
+    { .x = 137, .y = 127, .z = 118, .voxel_id = 1 },
+    { .x = 137, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 137, .y = 123, .z = 119, .voxel_id = 1 },
+    { .x = 137, .y = 124, .z = 119, .voxel_id = 1 },
+    { .x = 137, .y = 125, .z = 119, .voxel_id = 1 },
+    { .x = 137, .y = 126, .z = 119, .voxel_id = 1 },
+    { .x = 137, .y = 127, .z = 119, .voxel_id = 1 },
+    { .x = 137, .y = 128, .z = 119, .voxel_id = 1 },
+    { .x = 137, .y = 122, .z = 120, .voxel_id = 1 },
+    { .x = 137, .y = 123, .z = 120, .voxel_id = 1 },
+    { .x = 137, .y = 126, .z = 120, .voxel_id = 1 },
+    { .x = 137, .y = 127, .z = 120, .voxel_id = 1 },
+    { .x = 137, .y = 128, .z = 120, .voxel_id = 1 },
+    { .x = 137, .y = 126, .z = 121, .voxel_id = 1 },
+    { .x = 137, .y = 127, .z = 121, .voxel_id = 1 },
+    { .x = 137, .y = 128, .z = 121, .voxel_id = 1 },
+    { .x = 137, .y = 129, .z = 121, .voxel_id = 1 },
+    { .x = 137, .y = 125, .z = 122, .voxel_id = 1 },
+    { .x = 137, .y = 126, .z = 122, .voxel_id = 1 },
+    { .x = 137, .y = 127, .z = 122, .voxel_id = 1 },
+    { .x = 137, .y = 128, .z = 122, .voxel_id = 1 },
+    { .x = 137, .y = 126, .z = 123, .voxel_id = 1 },
+    { .x = 137, .y = 127, .z = 123, .voxel_id = 1 },
+    { .x = 137, .y = 128, .z = 123, .voxel_id = 1 },
+    { .x = 137, .y = 126, .z = 124, .voxel_id = 1 },
+    { .x = 137, .y = 127, .z = 124, .voxel_id = 1 },
+    { .x = 137, .y = 126, .z = 125, .voxel_id = 1 },
+    { .x = 137, .y = 127, .z = 125, .voxel_id = 1 },
+    { .x = 137, .y = 125, .z = 127, .voxel_id = 1 },
+    { .x = 137, .y = 126, .z = 127, .voxel_id = 1 },
+    { .x = 137, .y = 127, .z = 127, .voxel_id = 1 },
+    { .x = 137, .y = 128, .z = 127, .voxel_id = 1 },
+    { .x = 137, .y = 126, .z = 128, .voxel_id = 1 },
+    { .x = 137, .y = 127, .z = 128, .voxel_id = 1 },
+    { .x = 137, .y = 128, .z = 128, .voxel_id = 1 },
+    { .x = 137, .y = 128, .z = 129, .voxel_id = 1 },
+    { .x = 138, .y = 122, .z = 117, .voxel_id = 1 },
+    { .x = 138, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 138, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 138, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 138, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 138, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 138, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 138, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 138, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 138, .y = 124, .z = 118, .voxel_id = 1 },
+    { .x = 138, .y = 125, .z = 118, .voxel_id = 1 },
+    { .x = 138, .y = 126, .z = 118, .voxel_id = 1 },
+    { .x = 138, .y = 127, .z = 118, .voxel_id = 1 },
+    { .x = 138, .y = 128, .z = 118, .voxel_id = 1 },
+    { .x = 138, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 138, .y = 123, .z = 119, .voxel_id = 1 },
+    { .x = 138, .y = 124, .z = 119, .voxel_id = 1 },
+    { .x = 138, .y = 126, .z = 119, .voxel_id = 1 },
+    { .x = 138, .y = 127, .z = 119, .voxel_id = 1 },
+    { .x = 138, .y = 128, .z = 119, .voxel_id = 1 },
+    { .x = 138, .y = 122, .z = 120, .voxel_id = 1 },
+    { .x = 138, .y = 123, .z = 120, .voxel_id = 1 },
+    { .x = 139, .y = 122, .z = 116, .voxel_id = 1 },
+    { .x = 139, .y = 123, .z = 116, .voxel_id = 1 },
+    { .x = 139, .y = 124, .z = 116, .voxel_id = 1 },
+    { .x = 139, .y = 125, .z = 116, .voxel_id = 1 },
+    { .x = 139, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 139, .y = 127, .z = 116, .voxel_id = 1 },
+    { .x = 139, .y = 128, .z = 116, .voxel_id = 1 },
+    { .x = 139, .y = 122, .z = 117, .voxel_id = 1 },
+    { .x = 139, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 139, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 139, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 139, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 139, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 139, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 139, .y = 122, .z = 118, .voxel_id = 1 },
+    { .x = 139, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 139, .y = 124, .z = 118, .voxel_id = 1 },
+    { .x = 139, .y = 125, .z = 118, .voxel_id = 1 },
+    { .x = 139, .y = 126, .z = 118, .voxel_id = 1 },
+    { .x = 139, .y = 127, .z = 118, .voxel_id = 1 },
+    { .x = 139, .y = 128, .z = 118, .voxel_id = 1 },
+    { .x = 139, .y = 129, .z = 118, .voxel_id = 1 },
+    { .x = 139, .y = 122, .z = 119, .voxel_id = 1 },
+    { .x = 139, .y = 123, .z = 119, .voxel_id = 1 },
+    { .x = 139, .y = 128, .z = 119, .voxel_id = 1 },
+    { .x = 140, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 140, .y = 127, .z = 116, .voxel_id = 1 },
+    { .x = 140, .y = 128, .z = 116, .voxel_id = 1 },
+    { .x = 140, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 140, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 140, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 140, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 140, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 140, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 140, .y = 129, .z = 117, .voxel_id = 1 },
+    { .x = 140, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 140, .y = 124, .z = 118, .voxel_id = 1 },
+    { .x = 140, .y = 126, .z = 118, .voxel_id = 1 },
+    { .x = 140, .y = 127, .z = 118, .voxel_id = 1 },
+    { .x = 140, .y = 128, .z = 118, .voxel_id = 1 },
+    { .x = 140, .y = 129, .z = 118, .voxel_id = 1 },
+    { .x = 141, .y = 124, .z = 116, .voxel_id = 1 },
+    { .x = 141, .y = 125, .z = 116, .voxel_id = 1 },
+    { .x = 141, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 141, .y = 127, .z = 116, .voxel_id = 1 },
+    { .x = 141, .y = 128, .z = 116, .voxel_id = 1 },
+    { .x = 141, .y = 129, .z = 116, .voxel_id = 1 },
+    { .x = 141, .y = 123, .z = 117, .voxel_id = 1 },
+    { .x = 141, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 141, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 141, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 141, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 141, .y = 128, .z = 117, .voxel_id = 1 },
+    { .x = 141, .y = 129, .z = 117, .voxel_id = 1 },
+    { .x = 141, .y = 123, .z = 118, .voxel_id = 1 },
+    { .x = 141, .y = 124, .z = 118, .voxel_id = 1 },
+    { .x = 141, .y = 128, .z = 118, .voxel_id = 1 },
+    { .x = 142, .y = 124, .z = 116, .voxel_id = 1 },
+    { .x = 142, .y = 125, .z = 116, .voxel_id = 1 },
+    { .x = 142, .y = 126, .z = 116, .voxel_id = 1 },
+    { .x = 142, .y = 127, .z = 116, .voxel_id = 1 },
+    { .x = 142, .y = 128, .z = 116, .voxel_id = 1 },
+    { .x = 142, .y = 124, .z = 117, .voxel_id = 1 },
+    { .x = 142, .y = 125, .z = 117, .voxel_id = 1 },
+    { .x = 142, .y = 126, .z = 117, .voxel_id = 1 },
+    { .x = 142, .y = 127, .z = 117, .voxel_id = 1 },
+    { .x = 142, .y = 128, .z = 117, .voxel_id = 1 },
+};
+
 void load_monkey() {
-    set_voxel((v_pos){ .x = 113, .y = 124, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 113, .y = 125, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 113, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 113, .y = 127, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 113, .y = 128, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 113, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 113, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 113, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 113, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 113, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 124, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 125, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 127, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 128, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 129, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 129, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 124, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 114, .y = 128, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 127, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 128, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 129, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 124, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 126, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 127, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 128, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 115, .y = 129, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 122, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 123, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 124, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 125, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 127, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 128, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 122, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 124, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 125, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 126, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 127, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 128, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 129, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 123, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 116, .y = 128, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 122, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 124, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 125, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 126, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 127, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 128, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 123, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 124, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 126, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 127, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 128, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 122, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 117, .y = 123, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 122, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 124, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 125, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 126, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 127, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 123, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 124, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 125, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 126, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 127, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 128, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 122, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 123, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 126, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 127, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 128, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 126, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 127, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 128, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 129, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 125, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 126, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 127, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 128, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 126, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 127, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 128, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 126, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 127, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 126, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 127, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 125, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 126, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 127, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 128, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 126, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 127, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 118, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 124, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 125, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 126, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 127, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 128, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 129, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 130, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 123, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 124, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 125, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 126, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 127, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 128, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 129, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 130, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 122, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 123, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 124, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 125, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 126, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 127, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 128, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 129, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 130, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 131, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 123, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 124, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 125, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 126, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 128, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 129, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 130, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 123, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 124, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 125, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 130, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 123, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 124, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 125, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 128, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 129, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 130, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 123, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 124, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 125, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 126, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 129, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 124, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 125, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 126, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 127, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 128, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 129, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 124, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 125, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 126, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 127, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 128, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 124, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 125, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 126, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 127, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 128, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 124, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 125, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 126, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 127, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 126, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 127, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 119, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 125, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 127, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 128, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 129, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 129, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 130, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 131, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 123, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 130, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 131, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 122, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 123, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 124, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 130, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 131, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 132, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 122, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 123, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 124, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 130, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 131, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 122, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 123, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 130, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 131, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 122, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 123, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 130, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 131, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 123, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 124, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 129, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 123, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 124, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 128, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 129, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 123, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 124, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 125, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 128, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 123, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 124, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 128, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 123, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 124, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 125, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 126, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 125, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 126, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 127, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 120, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 126, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 127, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 129, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 123, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 124, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 125, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 127, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 128, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 129, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 130, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 131, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 129, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 130, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 131, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 132, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 123, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 132, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 122, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 132, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 133, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 122, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 122, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 131, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 132, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 122, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 131, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 132, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 123, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 128, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 129, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 130, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 123, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 124, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 128, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 129, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 123, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 124, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 128, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 122, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 123, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 124, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 125, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 126, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 127, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 123, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 125, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 126, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 127, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 130, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 121, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 127, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 128, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 129, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 124, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 125, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 126, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 127, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 128, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 129, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 130, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 123, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 124, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 125, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 129, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 130, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 131, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 122, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 131, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 132, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 133, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 132, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 133, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 121, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 132, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 133, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 121, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 122, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 132, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 133, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 121, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 122, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 133, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 121, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 122, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 132, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 133, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 122, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 132, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 133, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 122, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 132, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 133, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 122, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 123, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 129, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 130, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 131, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 132, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 122, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 123, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 129, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 130, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 131, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 122, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 123, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 122, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 123, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 124, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 130, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 123, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 125, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 126, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 127, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 130, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 124, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 125, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 126, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 130, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 122, .y = 129, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 125, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 126, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 127, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 128, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 129, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 123, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 124, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 129, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 130, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 131, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 122, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 123, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 124, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 130, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 131, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 132, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 121, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 122, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 131, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 132, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 133, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 121, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 133, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 121, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 133, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 121, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 133, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 134, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 121, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 133, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 134, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 121, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 122, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 133, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 121, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 122, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 133, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 121, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 122, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 132, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 133, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 122, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 131, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 132, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 133, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 122, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 129, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 130, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 131, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 122, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 130, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 113, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 114, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 122, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 130, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 122, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 123, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 130, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 131, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 123, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 124, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 125, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 126, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 130, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 131, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 125, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 126, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 127, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 129, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 123, .y = 130, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 128, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 129, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 123, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 124, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 125, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 126, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 127, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 128, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 129, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 122, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 123, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 124, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 129, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 130, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 131, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 121, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 122, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 123, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 131, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 132, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 121, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 122, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 132, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 133, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 120, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 121, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 133, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 120, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 121, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 133, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 120, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 121, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 133, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 134, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 120, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 121, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 134, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 120, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 133, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 133, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 120, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 121, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 133, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 120, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 121, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 131, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 132, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 133, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 113, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 114, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 115, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 116, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 121, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 130, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 131, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 132, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 113, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 114, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 115, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 116, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 117, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 118, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 119, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 121, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 122, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 130, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 113, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 114, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 115, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 116, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 117, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 118, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 119, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 121, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 122, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 130, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 131, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 113, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 114, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 115, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 116, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 117, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 118, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 119, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 122, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 123, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 131, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 123, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 124, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 125, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 130, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 131, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 132, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 125, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 126, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 127, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 129, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 130, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 124, .y = 131, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 127, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 128, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 129, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 123, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 124, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 125, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 126, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 127, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 128, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 121, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 122, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 123, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 130, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 131, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 132, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 121, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 122, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 131, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 132, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 133, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 121, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 132, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 133, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 121, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 119, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 133, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 134, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 119, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 133, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 134, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 119, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 134, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 119, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 119, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 133, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 119, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 133, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 119, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 121, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 133, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 113, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 114, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 115, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 116, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 117, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 118, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 119, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 121, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 130, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 131, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 113, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 114, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 117, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 118, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 119, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 121, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 122, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 130, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 131, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 113, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 119, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 121, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 122, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 130, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 131, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 113, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 114, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 115, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 116, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 117, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 118, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 119, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 121, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 130, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 131, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 115, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 116, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 117, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 118, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 119, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 120, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 122, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 123, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 124, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 125, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 126, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 131, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 125, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 126, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 127, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 128, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 129, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 130, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 125, .y = 131, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 124, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 127, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 128, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 129, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 123, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 124, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 126, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 127, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 121, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 131, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 132, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 121, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 132, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 133, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 120, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 121, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 133, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 119, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 120, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 119, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 120, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 119, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 134, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 119, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 134, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 119, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 119, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 133, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 119, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 133, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 118, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 119, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 133, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 114, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 115, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 116, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 117, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 118, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 113, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 130, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 131, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 113, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 130, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 113, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 114, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 115, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 120, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 121, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 122, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 125, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 126, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 127, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 130, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 131, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 114, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 115, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 116, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 117, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 118, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 119, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 120, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 121, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 122, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 123, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 124, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 125, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 126, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 130, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 131, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 121, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 122, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 123, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 128, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 129, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 130, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 126, .y = 131, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 124, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 128, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 129, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 121, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 123, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 124, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 121, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 121, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 132, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 133, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 119, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 119, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 119, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 134, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 134, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 118, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 119, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 133, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 116, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 117, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 118, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 133, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 113, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 114, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 115, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 116, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 117, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 113, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 114, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 130, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 113, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 130, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 113, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 114, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 115, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 126, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 114, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 115, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 116, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 117, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 118, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 119, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 120, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 121, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 122, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 124, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 125, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 126, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 120, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 121, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 122, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 126, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 127, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 128, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 127, .y = 129, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 124, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 128, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 129, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 121, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 123, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 124, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 121, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 121, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 132, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 133, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 119, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 119, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 119, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 134, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 134, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 118, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 119, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 133, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 116, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 117, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 118, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 133, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 113, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 114, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 115, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 116, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 117, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 113, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 114, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 130, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 113, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 130, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 113, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 114, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 115, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 126, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 114, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 115, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 116, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 117, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 118, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 119, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 120, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 121, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 122, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 124, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 125, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 126, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 120, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 121, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 122, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 126, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 127, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 128, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 128, .y = 129, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 124, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 127, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 128, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 129, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 123, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 124, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 126, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 127, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 121, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 131, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 132, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 121, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 132, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 133, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 120, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 121, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 133, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 119, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 120, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 119, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 120, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 119, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 134, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 119, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 134, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 119, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 119, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 133, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 119, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 133, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 118, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 119, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 133, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 114, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 115, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 116, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 117, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 118, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 113, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 130, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 131, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 113, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 130, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 113, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 114, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 115, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 120, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 121, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 122, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 125, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 126, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 127, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 130, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 131, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 114, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 115, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 116, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 117, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 118, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 119, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 120, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 121, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 122, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 123, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 124, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 125, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 126, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 130, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 131, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 121, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 122, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 123, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 128, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 129, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 130, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 129, .y = 131, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 127, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 128, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 129, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 123, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 124, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 125, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 126, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 127, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 128, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 121, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 122, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 123, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 130, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 131, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 132, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 121, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 122, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 131, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 132, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 133, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 121, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 132, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 133, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 121, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 119, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 133, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 134, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 119, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 133, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 134, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 119, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 134, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 119, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 119, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 133, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 119, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 133, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 119, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 121, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 133, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 113, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 114, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 115, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 116, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 117, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 118, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 119, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 121, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 130, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 131, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 113, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 114, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 117, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 118, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 119, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 121, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 122, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 130, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 131, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 113, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 119, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 121, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 122, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 130, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 131, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 113, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 114, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 115, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 116, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 117, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 118, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 119, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 121, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 130, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 131, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 115, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 116, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 117, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 118, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 119, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 120, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 122, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 123, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 124, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 125, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 126, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 131, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 125, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 126, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 127, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 128, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 129, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 130, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 130, .y = 131, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 128, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 129, .z = 113}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 123, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 124, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 125, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 126, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 127, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 128, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 129, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 122, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 123, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 124, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 129, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 130, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 131, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 121, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 122, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 123, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 131, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 132, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 121, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 122, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 132, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 133, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 120, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 121, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 133, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 120, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 121, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 133, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 120, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 121, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 133, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 134, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 120, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 121, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 134, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 120, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 133, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 133, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 120, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 121, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 133, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 120, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 121, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 131, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 132, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 133, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 113, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 114, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 115, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 116, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 121, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 130, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 131, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 132, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 113, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 114, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 115, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 116, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 117, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 118, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 119, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 121, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 122, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 130, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 113, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 114, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 115, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 116, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 117, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 118, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 119, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 121, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 122, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 130, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 131, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 113, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 114, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 115, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 116, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 117, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 118, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 119, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 122, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 123, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 131, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 123, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 124, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 125, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 130, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 131, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 132, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 125, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 126, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 127, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 129, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 130, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 131, .y = 131, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 125, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 126, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 127, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 128, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 129, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 123, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 124, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 129, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 130, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 131, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 122, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 123, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 124, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 130, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 131, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 132, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 121, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 122, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 131, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 132, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 133, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 121, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 133, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 121, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 133, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 121, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 133, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 134, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 121, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 133, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 134, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 121, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 122, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 133, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 121, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 122, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 133, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 121, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 122, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 132, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 133, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 122, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 131, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 132, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 133, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 122, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 129, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 130, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 131, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 122, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 130, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 113, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 114, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 122, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 130, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 122, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 123, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 130, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 131, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 123, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 124, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 125, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 126, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 130, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 131, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 125, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 126, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 127, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 129, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 132, .y = 130, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 127, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 128, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 129, .z = 114}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 124, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 125, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 126, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 127, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 128, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 129, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 130, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 123, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 124, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 125, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 129, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 130, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 131, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 122, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 131, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 132, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 133, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 132, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 133, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 121, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 132, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 133, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 121, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 122, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 132, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 133, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 121, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 122, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 133, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 121, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 122, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 132, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 133, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 122, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 132, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 133, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 122, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 132, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 133, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 122, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 123, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 129, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 130, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 131, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 132, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 122, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 123, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 129, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 130, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 131, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 122, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 123, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 122, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 123, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 124, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 130, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 123, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 125, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 126, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 127, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 130, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 124, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 125, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 126, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 130, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 133, .y = 129, .z = 131}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 126, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 127, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 129, .z = 115}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 123, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 124, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 125, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 127, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 128, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 129, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 130, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 131, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 129, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 130, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 131, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 132, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 123, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 132, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 122, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 132, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 133, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 122, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 122, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 131, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 132, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 122, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 131, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 132, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 123, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 128, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 129, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 130, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 123, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 124, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 128, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 129, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 123, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 124, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 128, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 122, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 123, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 124, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 125, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 126, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 127, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 123, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 125, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 126, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 127, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 130, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 134, .y = 129, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 125, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 127, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 128, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 129, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 129, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 130, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 131, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 123, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 130, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 131, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 122, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 123, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 124, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 130, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 131, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 132, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 122, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 123, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 124, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 130, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 131, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 122, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 123, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 130, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 131, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 122, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 123, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 130, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 131, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 123, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 124, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 129, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 123, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 124, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 128, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 129, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 123, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 124, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 125, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 128, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 123, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 124, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 128, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 129, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 123, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 124, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 125, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 126, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 129, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 124, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 125, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 126, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 127, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 127, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 135, .y = 128, .z = 130}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 124, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 125, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 126, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 127, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 128, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 129, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 130, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 123, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 124, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 125, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 126, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 127, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 128, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 129, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 130, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 122, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 123, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 124, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 125, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 126, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 127, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 128, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 129, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 130, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 131, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 123, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 124, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 125, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 126, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 128, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 129, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 130, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 123, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 124, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 125, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 130, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 123, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 124, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 125, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 128, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 129, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 130, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 123, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 124, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 125, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 126, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 129, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 124, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 125, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 126, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 127, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 128, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 129, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 124, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 125, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 126, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 127, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 128, .z = 126}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 124, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 125, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 126, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 127, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 128, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 124, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 125, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 126, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 127, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 126, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 127, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 136, .y = 129, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 122, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 124, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 125, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 126, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 127, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 123, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 124, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 125, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 126, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 127, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 128, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 122, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 123, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 126, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 127, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 128, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 126, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 127, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 128, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 129, .z = 121}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 125, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 126, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 127, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 128, .z = 122}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 126, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 127, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 128, .z = 123}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 126, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 127, .z = 124}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 126, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 127, .z = 125}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 125, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 126, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 127, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 128, .z = 127}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 126, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 127, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 128, .z = 128}, 1);
-    set_voxel((v_pos){ .x = 137, .y = 128, .z = 129}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 122, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 124, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 125, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 126, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 127, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 128, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 123, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 124, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 126, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 127, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 128, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 122, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 138, .y = 123, .z = 120}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 122, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 123, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 124, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 125, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 127, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 128, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 122, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 122, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 124, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 125, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 126, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 127, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 128, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 129, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 122, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 123, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 139, .y = 128, .z = 119}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 127, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 128, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 129, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 124, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 126, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 127, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 128, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 140, .y = 129, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 124, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 125, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 127, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 128, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 129, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 123, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 128, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 129, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 123, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 124, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 141, .y = 128, .z = 118}, 1);
-    set_voxel((v_pos){ .x = 142, .y = 124, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 142, .y = 125, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 142, .y = 126, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 142, .y = 127, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 142, .y = 128, .z = 116}, 1);
-    set_voxel((v_pos){ .x = 142, .y = 124, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 142, .y = 125, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 142, .y = 126, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 142, .y = 127, .z = 117}, 1);
-    set_voxel((v_pos){ .x = 142, .y = 128, .z = 117}, 1);
+    load_voxels(monkey_voxels, sizeof(monkey_voxels) / sizeof(monkey_voxels[0]));
 }
 
 #endif
\ No newline at end of file
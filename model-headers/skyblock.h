@@ -3,99 +3,103 @@
 
 #include "firmware/firmware.h"
 
-void load_skyblock() {
-	set_voxel((v_pos){0, 0, 0}, 1);
-	set_voxel((v_pos){1, 0, 0}, 1);
-	set_voxel((v_pos){2, 0, 0}, 1);
-	set_voxel((v_pos){3, 0, 0}, 1);
-	set_voxel((v_pos){4, 0, 0}, 1);
-	set_voxel((v_pos){5, 0, 0}, 1);
-	set_voxel((v_pos){0, 0, 1}, 1);
-	set_voxel((v_pos){1, 0, 1}, 1);
-	set_voxel((v_pos){2, 0, 1}, 1);
-	set_voxel((v_pos){3, 0, 1}, 1);
-	set_voxel((v_pos){4, 0, 1}, 1);
-	set_voxel((v_pos){5, 0, 1}, 1);
-	set_voxel((v_pos){0, 0, 2}, 1);
-	set_voxel((v_pos){1, 0, 2}, 1);
-	set_voxel((v_pos){2, 0, 2}, 1);
-	set_voxel((v_pos){3, 0, 2}, 1);
-	set_voxel((v_pos){4, 0, 2}, 1);
-	set_voxel((v_pos){5, 0, 2}, 1);
+static const struct gpu_voxel skyblock_voxels[] = {
+	{.x = 0, .y = 0, .z = 0, .voxel_id = 1},
+	{.x = 1, .y = 0, .z = 0, .voxel_id = 1},
+	{.x = 2, .y = 0, .z = 0, .voxel_id = 1},
+	{.x = 3, .y = 0, .z = 0, .voxel_id = 1},
+	{.x = 4, .y = 0, .z = 0, .voxel_id = 1},
+	{.x = 5, .y = 0, .z = 0, .voxel_id = 1},
+	{.x = 0, .y = 0, .z = 1, .voxel_id = 1},
+	{.x = 1, .y = 0, .z = 1, .voxel_id = 1},
+	{.x = 2, .y = 0, .z = 1, .voxel_id = 1},
+	{.x = 3, .y = 0, .z = 1, .voxel_id = 1},
+	{.x = 4, .y = 0, .z = 1, .voxel_id = 1},
+	{.x = 5, .y = 0, .z = 1, .voxel_id = 1},
+	{.x = 0, .y = 0, .z = 2, .voxel_id = 1},
+	{.x = 1, .y = 0, .z = 2, .voxel_id = 1},
+	{.x = 2, .y = 0, .z = 2, .voxel_id = 1},
+	{.x = 3, .y = 0, .z = 2, .voxel_id = 1},
+	{.x = 4, .y = 0, .z = 2, .voxel_id = 1},
+	{.x = 5, .y = 0, .z = 2, .voxel_id = 1},
+
+	{.x = 3, .y = 0, .z = 3, .voxel_id = 1},
+	{.x = 4, .y = 0, .z = 3, .voxel_id = 1},
+	{.x = 5, .y = 0, .z = 3, .voxel_id = 1},
+	{.x = 3, .y = 0, .z = 4, .voxel_id = 1},
+	{.x = 4, .y = 0, .z = 4, .voxel_id = 1},
+	{.x = 5, .y = 0, .z = 4, .voxel_id = 1},
+	{.x = 3, .y = 0, .z = 5, .voxel_id = 1},
+	{.x = 4, .y = 0, .z = 5, .voxel_id = 1},
+	{.x = 5, .y = 0, .z = 5, .voxel_id = 1},
 
-	set_voxel((v_pos){3, 0, 3}, 1);
-	set_voxel((v_pos){4, 0, 3}, 1);
-	set_voxel((v_pos){5, 0, 3}, 1);
-	set_voxel((v_pos){3, 0, 4}, 1);
-	set_voxel((v_pos){4, 0, 4}, 1);
-	set_voxel((v_pos){5, 0, 4}, 1);
-	set_voxel((v_pos){3, 0, 5}, 1);
-	set_voxel((v_pos){4, 0, 5}, 1);
-	set_voxel((v_pos){5, 0, 5}, 1);
+	{.x = 0, .y = 1, .z = 0, .voxel_id = 1},
+	{.x = 1, .y = 1, .z = 0, .voxel_id = 1},
+	{.x = 2, .y = 1, .z = 0, .voxel_id = 1},
+	{.x = 4, .y = 1, .z = 0, .voxel_id = 1},
+	{.x = 5, .y = 1, .z = 0, .voxel_id = 1},
+	{.x = 0, .y = 1, .z = 1, .voxel_id = 1},
+	{.x = 5, .y = 1, .z = 1, .voxel_id = 1},
+	{.x = 0, .y = 1, .z = 2, .voxel_id = 1},
+	{.x = 1, .y = 1, .z = 2, .voxel_id = 1},
+	{.x = 2, .y = 1, .z = 2, .voxel_id = 1},
+	{.x = 5, .y = 1, .z = 2, .voxel_id = 1},
 
-	set_voxel((v_pos){0, 1, 0}, 1);
-	set_voxel((v_pos){1, 1, 0}, 1);
-	set_voxel((v_pos){2, 1, 0}, 1);
-	set_voxel((v_pos){4, 1, 0}, 1);
-	set_voxel((v_pos){5, 1, 0}, 1);
-	set_voxel((v_pos){0, 1, 1}, 1);
-	set_voxel((v_pos){5, 1, 1}, 1);
-	set_voxel((v_pos){0, 1, 2}, 1);
-	set_voxel((v_pos){1, 1, 2}, 1);
-	set_voxel((v_pos){2, 1, 2}, 1);
-	set_voxel((v_pos){5, 1, 2}, 1);
+	{.x = 3, .y = 1, .z = 3, .voxel_id = 1},
+	{.x = 4, .y = 1, .z = 3, .voxel_id = 1},
+	{.x = 5, .y = 1, .z = 3, .voxel_id = 1},
+	{.x = 3, .y = 1, .z = 4, .voxel_id = 1},
+	{.x = 4, .y = 1, .z = 4, .voxel_id = 1},
+	{.x = 5, .y = 1, .z = 4, .voxel_id = 1},
+	{.x = 3, .y = 1, .z = 5, .voxel_id = 1},
+	{.x = 4, .y = 1, .z = 5, .voxel_id = 1},
+	{.x = 5, .y = 1, .z = 5, .voxel_id = 1},
 
-	set_voxel((v_pos){3, 1, 3}, 1);
-	set_voxel((v_pos){4, 1, 3}, 1);
-	set_voxel((v_pos){5, 1, 3}, 1);
-	set_voxel((v_pos){3, 1, 4}, 1);
-	set_voxel((v_pos){4, 1, 4}, 1);
-	set_voxel((v_pos){5, 1, 4}, 1);
-	set_voxel((v_pos){3, 1, 5}, 1);
-	set_voxel((v_pos){4, 1, 5}, 1);
-	set_voxel((v_pos){5, 1, 5}, 1);
+	{.x = 0, .y = 2, .z = 0, .voxel_id = 2},
+	{.x = 1, .y = 2, .z = 0, .voxel_id = 2},
+	{.x = 2, .y = 2, .z = 0, .voxel_id = 2},
+	{.x = 4, .y = 2, .z = 0, .voxel_id = 2},
+	{.x = 5, .y = 2, .z = 0, .voxel_id = 2},
+	{.x = 0, .y = 2, .z = 1, .voxel_id = 2},
+	{.x = 1, .y = 2, .z = 1, .voxel_id = 2},
+	{.x = 2, .y = 2, .z = 1, .voxel_id = 2},
+	{.x = 3, .y = 2, .z = 1, .voxel_id = 2},
+	{.x = 4, .y = 2, .z = 1, .voxel_id = 2},
+	{.x = 5, .y = 2, .z = 1, .voxel_id = 2},
+	{.x = 0, .y = 2, .z = 2, .voxel_id = 2},
+	{.x = 1, .y = 2, .z = 2, .voxel_id = 2},
+	{.x = 2, .y = 2, .z = 2, .voxel_id = 2},
+	{.x = 3, .y = 2, .z = 2, .voxel_id = 2},
+	{.x = 4, .y = 2, .z = 2, .voxel_id = 2},
+	{.x = 5, .y = 2, .z = 2, .voxel_id = 2},
 
-	set_voxel((v_pos){0, 2, 0}, 2);
-	set_voxel((v_pos){1, 2, 0}, 2);
-	set_voxel((v_pos){2, 2, 0}, 2);
-	set_voxel((v_pos){4, 2, 0}, 2);
-	set_voxel((v_pos){5, 2, 0}, 2);
-	set_voxel((v_pos){0, 2, 1}, 2);
-	set_voxel((v_pos){1, 2, 1}, 2);
-	set_voxel((v_pos){2, 2, 1}, 2);
-	set_voxel((v_pos){3, 2, 1}, 2);
-	set_voxel((v_pos){4, 2, 1}, 2);
-	set_voxel((v_pos){5, 2, 1}, 2);
-	set_voxel((v_pos){0, 2, 2}, 2);
-	set_voxel((v_pos){1, 2, 2}, 2);
-	set_voxel((v_pos){2, 2, 2}, 2);
-	set_voxel((v_pos){3, 2, 2}, 2);
-	set_voxel((v_pos){4, 2, 2}, 2);
-	set_voxel((v_pos){5, 2, 2}, 2);
+	{.x = 3, .y = 2, .z = 3, .voxel_id = 2},
+	{.x = 4, .y = 2, .z = 3, .voxel_id = 2},
+	{.x = 5, .y = 2, .z = 3, .voxel_id = 2},
+	{.x = 3, .y = 2, .z = 4, .voxel_id = 2},
+	{.x = 5, .y = 2, .z = 4, .voxel_id = 2},
+	{.x = 3, .y = 2, .z = 5, .voxel_id = 2},
+	{.x = 4, .y = 2, .z = 5, .voxel_id = 2},
+	{.x = 5, .y = 2, .z = 5, .voxel_id = 2},
 
-	set_voxel((v_pos){3, 2, 3}, 2);
-	set_voxel((v_pos){4, 2, 3}, 2);
-	set_voxel((v_pos){5, 2, 3}, 2);
-	set_voxel((v_pos){3, 2, 4}, 2);
-	set_voxel((v_pos){5, 2, 4}, 2);
-	set_voxel((v_pos){3, 2, 5}, 2);
-	set_voxel((v_pos){4, 2, 5}, 2);
-	set_voxel((v_pos){5, 2, 5}, 2);
+	{.x = 4, .y = 3, .z = 4, .voxel_id = 1},
+	{.x = 4, .y = 4, .z = 4, .voxel_id = 1},
+	{.x = 3, .y = 5, .z = 4, .voxel_id = 2},
+	{.x = 5, .y = 5, .z = 4, .voxel_id = 2},
+	{.x = 4, .y = 5, .z = 3, .voxel_id = 2},
+	{.x = 4, .y = 5, .z = 5, .voxel_id = 2},
+	{.x = 4, .y = 6, .z = 4, .voxel_id = 2},
 
-	set_voxel((v_pos){4, 3, 4}, 1);
-	set_voxel((v_pos){4, 4, 4}, 1);
-	set_voxel((v_pos){3, 5, 4}, 2);
-	set_voxel((v_pos){5, 5, 4}, 2);
-	set_voxel((v_pos){4, 5, 3}, 2);
-	set_voxel((v_pos){4, 5, 5}, 2);
-	set_voxel((v_pos){4, 6, 4}, 2);
+	{.x = 3, .y = 2, .z = 0, .voxel_id = 3},
+	{.x = 3, .y = 2, .z = -1, .voxel_id = 3},
+	{.x = 3, .y = 1, .z = -1, .voxel_id = 3},
+	{.x = 3, .y = 0, .z = -1, .voxel_id = 3},
+	{.x = 3, .y = -1, .z = -1, .voxel_id = 3},
+	{.x = 3, .y = -2, .z = -1, .voxel_id = 3},
+};
 
-	set_voxel((v_pos){3, 2, 0}, 3);
-	set_voxel((v_pos){3, 2, -1}, 3);
-	set_voxel((v_pos){3, 1, -1}, 3);
-	set_voxel((v_pos){3, 0, -1}, 3);
-	set_voxel((v_pos){3, -1, -1}, 3);
-	set_voxel((v_pos){3, -2, -1}, 3);
+void load_skyblock() {
+	load_voxels(skyblock_voxels, sizeof(skyblock_voxels) / sizeof(skyblock_voxels[0]));
 }
 
 #endif // SKYBLOCK_H
@@ -3,7 +3,10 @@
 #include "firmware/interrupts.h"
 #include "firmware/firmware.h"
 #include "software/software_render.h"
+#include "software/spatial_query.h"
+#include "firmware/world.h"
 #include "firmware/character_print.h"
+#include <math.h>
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -288,17 +291,52 @@ void update_camera() {
     set_camera(camera);
 }
 
-uint8_t get_target_voxel(int16_t *x, int16_t *y, int16_t *z) {
-    // Currently, just place 2 voxels ahead of where camera looking
-    struct Vector offset = multiply_vector(camera->look, 30.0f);
+// Furthest a voxel can be placed from the camera
+#define PLACE_DISTANCE 30.0f
+
+// How far back from a picked surface the placed voxel's cell is sampled
+#define PICK_BACKOFF 0.05f
+
+uint8_t get_target_voxel(int32_t *x, int32_t *y, int32_t *z) {
+    // Snap to the face under the crosshair; the occupancy grid is in voxel space
+    struct Vector origin = {
+        camera->pos.x - world_origin.x,
+        camera->pos.y - world_origin.y,
+        camera->pos.z - world_origin.z
+    };
+
+    // What the GPU drew under the crosshair last frame is what the player aimed at,
+    // so step back off its surface rather than tracing the ray again
+    if (gpu_pick.hit) {
+        struct Vector to_hit = sub_vector(gpu_pick.point, origin);
+        float distance = sqrtf(to_hit.x * to_hit.x + to_hit.y * to_hit.y + to_hit.z * to_hit.z);
+        if (distance <= PLACE_DISTANCE && distance > PICK_BACKOFF) {
+            struct Vector empty = sub_vector(gpu_pick.point, multiply_vector(to_hit, PICK_BACKOFF / distance));
+            *x = (int32_t)floorf(empty.x) + world_origin.x;
+            *y = (int32_t)floorf(empty.y) + world_origin.y;
+            *z = (int32_t)floorf(empty.z) + world_origin.z;
+            return 1;
+        }
+    }
+
+    struct voxel_pick pick;
+    if (pick_voxel(&origin, &camera->look, PLACE_DISTANCE, &pick)) {
+        *x = pick.empty.x + world_origin.x;
+        *y = pick.empty.y + world_origin.y;
+        *z = pick.empty.z + world_origin.z;
+        return 1;
+    }
+
+    // Nothing within reach, so place it in mid-air as far ahead as reach allows
+    struct Vector offset = multiply_vector(camera->look, PLACE_DISTANCE);
     struct Vector target_pos = add_vector(camera->pos, offset);
 
     int cx = (int)target_pos.x;
     int cy = (int)target_pos.y;
     int cz = (int)target_pos.z;
 
-    *x = (int16_t)cx;
-    *y = (int16_t)cy;
-    *z = (int16_t)cz;
+    *x = cx;
+    *y = cy;
+    *z = cz;
     return 1;
 }
@@ -1,5 +1,394 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "software/debug.h"
+#include "software/software_render.h"
+#include "firmware/timing.h"
+#include "software/spatial_query.h"
+#include "software/occupancy.h"
+#include "firmware/world.h"
+#include "firmware/edit_journal.h"
+#include "firmware/world_stream.h"
+#include "firmware/palette.h"
+#include "firmware/lod.h"
+#include "software/greedy_mesh.h"
+
+#define BENCH_TERRAIN_SIDE 256
+#define BENCH_TERRAIN_DEPTH 4
+#define BENCH_QUERIES 100000
+#define BENCH_QUERY_BOX 8
+#define BENCH_FRAMES 16
+#define BENCH_EDITS 64          // edits queued per frame
+#define BENCH_WORLD_SIDE 2048
+#define BENCH_WORLD_TILE 16     // terrain height is constant over tiles this wide
+#define BENCH_WORLD_SPEED 2     // voxels the camera flies along x and z per frame
 
 void debug_start(){}
 
-void debug_end(){}
\ No newline at end of file
+void debug_end(){}
+
+// Seconds since the timer was enabled, as render() measures GPU latency
+static float bench_seconds() {
+    return fw_time + (200E6f - cur_time()) / 200E6f;
+}
+
+// Palette the boxes and bricks sent to the GPU draw at pos, or 0 if they leave it empty
+static uint8_t drawn_palette(v_pos pos) {
+    for (unsigned int i = 0; i < voxel_box_count; i++) {
+        const struct voxel_box* box = &voxel_boxes[i];
+        if (box_in_bricks(box)) continue;
+        if (pos.x >= box->min.x && pos.x <= box->min.x + box->extent.x
+            && pos.y >= box->min.y && pos.y <= box->min.y + box->extent.y
+            && pos.z >= box->min.z && pos.z <= box->min.z + box->extent.z)
+            return box->min.voxel_id;
+    }
+    for (unsigned int i = 0; i < brick_packet_count; i++) {
+        const struct brick_packet* brick = &brick_packets[i];
+        int dx = pos.x - brick->origin.x, dy = pos.y - brick->origin.y, dz = pos.z - brick->origin.z;
+        if (dx < 0 || dx > 3 || dy < 0 || dy > 3 || dz < 0 || dz > 3) continue;
+        if ((brick->mask >> ((dz << 4) | (dy << 2) | dx)) & 1) return brick->origin.voxel_id;
+    }
+    return 0;
+}
+
+int test_edit_journal() {
+    // An L of three voxels, as load_monkey or load_scene would leave it
+    static const struct gpu_voxel scene[] = {
+        {.x = 0, .y = 0, .z = 0, .voxel_id = 1},
+        {.x = 1, .y = 0, .z = 0, .voxel_id = 1},
+        {.x = 0, .y = 1, .z = 0, .voxel_id = 2},
+    };
+    world_clear();
+    clear_voxel_list();
+    init_voxel_list();
+    load_voxels(scene, sizeof(scene) / sizeof(scene[0]));
+    update_lod_regions();
+
+    // Only the chunks the edits touched are rebuilt, so what is drawn must follow them too
+    queue_voxel_edit((w_pos){0, 0, 1}, 3);
+    queue_voxel_edit((w_pos){1, 0, 0}, 0);
+    render();
+    update_lod_regions();
+
+    int passed = voxel_count == 3 && world_voxel_count == 0
+        && get_voxel((v_pos){0, 0, 1}) == 3 && get_voxel((v_pos){1, 0, 0}) == 0
+        && get_voxel((v_pos){0, 0, 0}) == 1 && get_voxel((v_pos){0, 1, 0}) == 2
+        && drawn_palette((v_pos){0, 0, 1}) == 3 && drawn_palette((v_pos){1, 0, 0}) == 0
+        && drawn_palette((v_pos){0, 0, 0}) == 1 && drawn_palette((v_pos){0, 1, 0}) == 2;
+    printf("Edit journal on a loaded scene: %s (%u voxels)\n", passed ? "passed" : "FAILED", voxel_count);
+    return passed;
+}
+
+// xorshift, so the scattered positions are the same on every run
+static uint32_t xorshift(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+// The voxel list as it was before load_bench_terrain replaced it
+static struct gpu_voxel* saved_voxels;
+static unsigned int saved_voxel_count;
+
+// Rolling terrain, a few voxels thick, over BENCH_TERRAIN_SIDE^2 columns.
+// The voxel list it replaces is put back by restore_voxel_list
+static void load_bench_terrain() {
+    saved_voxels = (struct gpu_voxel*)malloc((voxel_count ? voxel_count : 1) * sizeof(struct gpu_voxel));
+    if (saved_voxels == NULL) {
+        printf("Failed to allocate memory for saved voxels\n");
+        while (1);
+    }
+    memcpy(saved_voxels, voxel_space, voxel_count * sizeof(struct gpu_voxel));
+    saved_voxel_count = voxel_count;
+
+    clear_voxel_list();
+    init_voxel_list();
+    static struct gpu_voxel column[BENCH_TERRAIN_SIDE * BENCH_TERRAIN_DEPTH];
+    for (int z = 0; z < BENCH_TERRAIN_SIDE; z++) {
+        for (int x = 0; x < BENCH_TERRAIN_SIDE; x++) {
+            int height = 32 + ((x * 7) ^ (z * 13)) % 8 + ((x + z) >> 4);
+            for (int d = 0; d < BENCH_TERRAIN_DEPTH; d++)
+                column[x * BENCH_TERRAIN_DEPTH + d] = (struct gpu_voxel){
+                    .x = x - BENCH_TERRAIN_SIDE / 2, .y = height - d, .z = z - BENCH_TERRAIN_SIDE / 2,
+                    .voxel_id = 1 + (d > 0)
+                };
+        }
+        load_voxels(column, BENCH_TERRAIN_SIDE * BENCH_TERRAIN_DEPTH);
+    }
+}
+
+static void restore_voxel_list() {
+    clear_voxel_list();
+    init_voxel_list();
+    load_voxels(saved_voxels, saved_voxel_count);
+    free(saved_voxels);
+    saved_voxels = NULL;
+}
+
+void benchmark_spatial_query() {
+    load_bench_terrain();
+    float start = bench_seconds();
+    update_occupancy();
+    float build_time = bench_seconds() - start;
+    struct Vector origin = {0.5f, 100.5f, 0.5f};
+    struct voxel_pick pick;
+
+    // Rays from above the middle of the terrain, fanned out in every downward direction
+    uint32_t state = 0x12345678;
+    unsigned int hits = 0;
+    start = bench_seconds();
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        uint32_t r = xorshift(&state);
+        struct Vector dir = {(float)(int)(r & 1023) - 512, -256.0f, (float)(int)((r >> 10) & 1023) - 512};
+        hits += pick_voxel(&origin, &dir, 1000.0f, &pick);
+    }
+    float pick_time = bench_seconds() - start;
+
+    unsigned int overlaps = 0, voxels = 0;
+    start = bench_seconds();
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        uint32_t r = xorshift(&state);
+        v_pos min = {(int)(r & 255) - 128, 24 + (int)((r >> 8) & 31), (int)((r >> 13) & 255) - 128};
+        v_pos max = {min.x + BENCH_QUERY_BOX - 1, min.y + BENCH_QUERY_BOX - 1, min.z + BENCH_QUERY_BOX - 1};
+        overlaps += box_overlaps_voxels(min, max);
+    }
+    float overlap_time = bench_seconds() - start;
+    start = bench_seconds();
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        uint32_t r = xorshift(&state);
+        v_pos min = {(int)(r & 255) - 128, 24 + (int)((r >> 8) & 31), (int)((r >> 13) & 255) - 128};
+        v_pos max = {min.x + BENCH_QUERY_BOX - 1, min.y + BENCH_QUERY_BOX - 1, min.z + BENCH_QUERY_BOX - 1};
+        voxels += count_voxels_in_box(min, max);
+    }
+    float count_time = bench_seconds() - start;
+
+    printf("Spatial query over %u voxels, grid built in %.2f ms\n", voxel_count, build_time * 1000.0f);
+    printf("Ray pick:    %.0f queries/s (%u hits)\n", BENCH_QUERIES / pick_time, hits);
+    printf("Box overlap: %.0f queries/s (%u overlapping)\n", BENCH_QUERIES / overlap_time, overlaps);
+    printf("Box count:   %.0f queries/s (%u voxels)\n", BENCH_QUERIES / count_time, voxels);
+    restore_voxel_list();
+}
+
+void benchmark_lod() {
+    cam_pos camera = camera_position;
+    load_bench_terrain();
+    set_camera_settings(90.0f, 1.0f);
+    float start = bench_seconds();
+    unsigned int region_count = update_lod_regions();
+    float update_time = bench_seconds() - start;
+    unsigned int full_bricks = 0;
+    for (unsigned int i = 0; i < region_count; i++)
+        full_bricks += lod_regions[i].brick_count;
+    printf("LOD over %u voxels: %u regions, %u bricks at full detail, built in %.2f ms\n",
+        voxel_count, region_count, full_bricks, update_time * 1000.0f);
+
+    // Every brick drawn is rasterized once per chunk of the frame, so the bricks drawn are the GPU's frame cost
+    static const float heights[] = {64.0f, 192.0f, 448.0f};
+    for (unsigned int h = 0; h < sizeof(heights) / sizeof(heights[0]); h++) {
+        camera_position = (cam_pos){0.5f, heights[h], 0.5f};
+        start = bench_seconds();
+        select_lod_levels();
+        float select_time = bench_seconds() - start;
+        unsigned int drawn = 0;
+        for (unsigned int i = 0; i < region_count; i++) {
+            const struct lod_region* region = &lod_regions[i];
+            drawn += region->level == 0 ? region->brick_count : region->coarse_count[region->level - 1];
+        }
+        printf("LOD from y = %.0f: %u of %u bricks drawn (%.0f%%), levels chosen in %.2f ms\n",
+            heights[h], drawn, full_bricks, 100.0f * drawn / full_bricks, select_time * 1000.0f);
+    }
+    camera_position = camera;
+    restore_voxel_list();
+}
+
+void benchmark_voxel_edits() {
+    load_bench_terrain();
+    float start = bench_seconds();
+    update_lod_regions();
+    float build_time = bench_seconds() - start;
+
+    // Edits around the surface near a spot that wanders over the terrain, as a player
+    // digging and building would make them. They go straight to the voxel space, as
+    // apply_voxel_edits sends them while the world is not in use, so the world is left alone
+    struct gpu_voxel edits[BENCH_EDITS];
+    uint32_t state = 0x9E3779B9;
+    unsigned int changed = 0;
+    float apply_time = 0.0f, rebuild_time = 0.0f, worst = 0.0f;
+    for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+        uint32_t spot = xorshift(&state);
+        int spot_x = (int)(spot & 255) - 128, spot_z = (int)((spot >> 8) & 255) - 128;
+        for (int i = 0; i < BENCH_EDITS; i++) {
+            uint32_t r = xorshift(&state);
+            edits[i] = (struct gpu_voxel){
+                .x = spot_x + (int)(r & 15) - 8, .y = 32 + (int)((r >> 4) & 15), .z = spot_z + (int)((r >> 8) & 15) - 8,
+                .voxel_id = (r >> 12) & 3
+            };
+        }
+        start = bench_seconds();
+        reserve_voxels(voxel_count + BENCH_EDITS);
+        for (int i = 0; i < BENCH_EDITS; i++) {
+            v_pos pos = {edits[i].x, edits[i].y, edits[i].z};
+            if (get_voxel(pos) == edits[i].voxel_id) continue;
+            set_voxel(pos, edits[i].voxel_id);
+            ++changed;
+        }
+        float applied = bench_seconds();
+        update_lod_regions();
+        float end = bench_seconds();
+        apply_time += applied - start;
+        rebuild_time += end - applied;
+        if (end - applied > worst) worst = end - applied;
+    }
+
+    printf("Edits over %u voxels: %u changed per frame, applied in %.2f ms\n",
+        voxel_count, changed / BENCH_FRAMES, apply_time * 1000.0f / BENCH_FRAMES);
+    printf("Boxes, bricks and LOD rebuilt in %.2f ms per frame (worst %.2f), built from scratch in %.2f ms\n",
+        rebuild_time * 1000.0f / BENCH_FRAMES, worst * 1000.0f, build_time * 1000.0f);
+    restore_voxel_list();
+}
+
+void benchmark_greedy_mesh(const char* name, const struct gpu_voxel* voxels, unsigned int count) {
+    setup_pixel_buffer_software();
+    set_camera_settings_software(90.0, 1);
+    set_render_mode_software(SOFTWARE_RENDER_RASTER);
+    clear_voxel_list();
+    init_voxel_list();
+    load_voxels(voxels, count);
+
+    float start = bench_seconds();
+    unsigned int quads = update_greedy_mesh();
+    float mesh_time = bench_seconds() - start;
+
+    // Look at the model head on along +z from just outside its bounding box
+    v_pos min = {voxels[0].x, voxels[0].y, voxels[0].z}, max = min;
+    for (unsigned int i = 1; i < count; i++) {
+        if (voxels[i].x < min.x) min.x = voxels[i].x;
+        if (voxels[i].y < min.y) min.y = voxels[i].y;
+        if (voxels[i].z < min.z) min.z = voxels[i].z;
+        if (voxels[i].x > max.x) max.x = voxels[i].x;
+        if (voxels[i].y > max.y) max.y = voxels[i].y;
+        if (voxels[i].z > max.z) max.z = voxels[i].z;
+    }
+    struct Vector eye = {
+        (min.x + max.x + 1) * 0.5f,
+        (min.y + max.y + 1) * 0.5f,
+        min.z - (max.x - min.x + 1) - 1.0f
+    };
+    set_camera_default_software(eye, (struct Vector){0, 0, 1}, (struct Vector){0, 1, 0});
+
+    unsigned int quads_drawn = 0, triangles = 0;
+    start = bench_seconds();
+    for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+        render_software();
+        quads_drawn += software_render_stats.quads_drawn;
+        triangles += software_render_stats.triangles;
+    }
+    float frame_time = (bench_seconds() - start) / BENCH_FRAMES;
+
+    printf("Greedy mesh %s: %u voxels in %u quads, built in %.2f ms; %u quads and %u triangles per frame, %.2f ms/frame\n",
+        name, voxel_count, quads, mesh_time * 1000.0f,
+        quads_drawn / BENCH_FRAMES, triangles / BENCH_FRAMES, frame_time * 1000.0f);
+    clear_voxel_list();
+    init_voxel_list();
+}
+
+static int bench_world_height(int x, int z) {
+    int tx = x / BENCH_WORLD_TILE, tz = z / BENCH_WORLD_TILE;
+    return 16 + ((tx * 7 + tz * 13 + ((tx ^ tz) & 3)) & 15);
+}
+
+// A BENCH_WORLD_SIDE^2 world file image of terrain two voxels thick, from (0, 0, 0) along +x and +z
+static uint32_t* build_world_image(size_t* size) {
+    const int regions_per_side = BENCH_WORLD_SIDE / WORLD_REGION_SIZE;
+    const int tiles_per_region = WORLD_REGION_SIZE / BENCH_WORLD_TILE;
+    // every row of tiles along x holds a top and a bottom run per tile
+    const uint32_t runs = WORLD_REGION_SIZE * tiles_per_region * 2;
+    const uint32_t region_count = regions_per_side * regions_per_side;
+    const uint32_t palette_size = 1 << VOXEL_BITS;
+    const uint32_t index_offset = sizeof(struct world_file_header) + ((palette_size * sizeof(uint16_t) + 3) & ~3u);
+    const uint32_t data_offset = index_offset + region_count * sizeof(struct world_file_region);
+    *size = data_offset + (size_t)region_count * runs * sizeof(uint32_t);
+
+    uint32_t* image = (uint32_t*)calloc(*size / sizeof(uint32_t), sizeof(uint32_t));
+    if (image == NULL) {
+        printf("Failed to allocate memory for world stream benchmark\n");
+        while (1);
+    }
+    uint8_t* bytes = (uint8_t*)image;
+    struct world_file_header* header = (struct world_file_header*)bytes;
+    memcpy(header->magic, WORLD_FILE_MAGIC, sizeof(header->magic));
+    header->version = WORLD_FILE_VERSION;
+    header->palette_size = palette_size;
+    header->region_count = region_count;
+    memcpy(bytes + sizeof(struct world_file_header), palette_data, palette_size * sizeof(uint16_t));
+
+    struct world_file_region* index = (struct world_file_region*)(bytes + index_offset);
+    uint32_t* data = (uint32_t*)(bytes + data_offset);
+    uint32_t offset = data_offset;
+    for (int rz = 0; rz < regions_per_side; rz++)
+        for (int rx = 0; rx < regions_per_side; rx++) {
+            index[rz * regions_per_side + rx] = (struct world_file_region){rx, 0, rz, offset, runs, runs * BENCH_WORLD_TILE};
+            offset += runs * sizeof(uint32_t);
+            // runs sorted by cell: z, then y, then x
+            for (int cz = 0; cz < WORLD_REGION_SIZE; cz++)
+                for (int cy = 0; cy < WORLD_REGION_SIZE; cy++)
+                    for (int t = 0; t < tiles_per_region; t++) {
+                        int cx = t * BENCH_WORLD_TILE;
+                        int height = bench_world_height(rx * WORLD_REGION_SIZE + cx, rz * WORLD_REGION_SIZE + cz);
+                        if (cy != height && cy != height - 1) continue;
+                        uint32_t cell = (cz << (2 * WORLD_REGION_SHIFT)) | (cy << WORLD_REGION_SHIFT) | cx;
+                        *data++ = cell << 14 | (uint32_t)(cy == height ? 1 : 2) << 6 | (BENCH_WORLD_TILE - 1);
+                    }
+        }
+    return image;
+}
+
+void benchmark_world_stream(const char* path) {
+    size_t size = 0;
+    uint32_t* image = NULL;
+    if (path != NULL) {
+        if (world_stream_open_file(path) != 0) return;
+    } else {
+        image = build_world_image(&size);
+        if (world_stream_open_image(image, size) != 0) {
+            free(image);
+            return;
+        }
+    }
+    clear_voxel_list();
+    init_voxel_list();
+
+    // Fly diagonally across the world, doing each frame what set_camera and then render do
+    unsigned int frames = 0, filling = 0, worst_frame = 0;
+    float total = 0.0f, worst = 0.0f, rebuild = 0.0f;
+    for (int d = WORLD_REGION_SIZE; d < BENCH_WORLD_SIDE - WORLD_REGION_SIZE; d += BENCH_WORLD_SPEED) {
+        float x = d + 0.5f, y = 48.5f, z = d + 0.5f;
+        float start = bench_seconds();
+        world_stream_update(x, y, z);
+        filling += world_follow_camera(x, y, z) != 0;
+        float streamed = bench_seconds();
+        update_lod_regions();
+        float end = bench_seconds();
+        rebuild += end - streamed;
+        float frame = end - start;
+        total += frame;
+        if (frame > worst) {
+            worst = frame;
+            worst_frame = frames;
+        }
+        frames++;
+    }
+
+    printf("World stream %s: %u frames, %.2f ms/frame (%.2f rebuilding boxes, bricks and LOD), worst %.2f ms (frame %u), %u frames filling the window\n",
+        path != NULL ? path : "generated terrain", frames, total * 1000.0f / frames, rebuild * 1000.0f / frames,
+        worst * 1000.0f, worst_frame, filling);
+    printf("World stream: %u regions read, %u evicted, %u voxels resident, %u in the voxel space\n",
+        world_stream_loads, world_stream_evictions, world_voxel_count, voxel_count);
+
+    world_stream_close();
+    world_clear();
+    free(image);
+    clear_voxel_list();
+    init_voxel_list();
+}
@@ -1,5 +1,52 @@
 #ifndef DEBUG_TEST
 
+#include "firmware/firmware.h"
+
 void debug_start();
 void debug_end();
-#endif
\ No newline at end of file
+
+/** @brief Times ray picks and box queries against a large terrain of voxels and
+ *  prints the queries per second of each. Puts the voxel space back as it was when done
+ */
+void benchmark_spatial_query();
+
+/** @brief Builds LOD regions for a large terrain and prints, for cameras at a few heights
+ *  above it, how many bricks each frame chunk draws against drawing everything at full detail.
+ *  Puts the voxel space and camera_position back as they were when done
+ */
+void benchmark_lod();
+
+/** @brief Loads a small scene straight into the voxel space, queues an insert and a
+ *  removal, renders a frame and checks that both landed without the scene being
+ *  replaced, and that the boxes and bricks drawn follow them.
+ *  Replaces the voxel space and empties the world
+ *  @return 1 if the check passed, 0 otherwise
+ */
+int test_edit_journal();
+
+/** @brief Builds the boxes, bricks and LOD regions of a large terrain, then applies
+ *  a batch of edits every frame and prints how long applying them and
+ *  rebuilding what they changed takes, against building everything from scratch.
+ *  Puts the voxel space back as it was when done, and leaves the world alone
+ */
+void benchmark_voxel_edits();
+
+/** @brief Meshes a model, renders it with the software rasterizer and prints the quads
+ *  and triangles per frame and the frame time. Points the software camera at the model
+ *  and switches to SOFTWARE_RENDER_RASTER. Replaces the voxel space, and leaves it empty when done
+ *  @param name name to print the results under
+ *  @param voxels voxel table of the model, e.g. monkey_voxels from model-headers/monkey.h
+ *  @param count number of voxels in the table
+ */
+void benchmark_greedy_mesh(const char* name, const struct gpu_voxel* voxels, unsigned int count);
+
+/** @brief Streams a world while flying the camera diagonally across it, as set_camera would,
+ *  and prints the average and worst frame cost of streaming, filling the window and
+ *  rebuilding the boxes, bricks and LOD regions render draws from it.
+ *  Worlds written by convert-obj.py with WN 2048 cover the same area as the generated one
+ *  @param path .vxw file to open with world_stream_open_file, or NULL to open a generated
+ *  2048x2048 terrain image with world_stream_open_image
+ *  Replaces the world and the voxel space, and leaves both empty when done
+ */
+void benchmark_world_stream(const char* path);
+#endif
@@ -0,0 +1,51 @@
+#include <stdlib.h>
+#include "software/frame_arena.h"
+
+#define ALIGN_SIZE(size) (((size) + FRAME_ARENA_ALIGN - 1) & ~(size_t)(FRAME_ARENA_ALIGN - 1))
+
+static uint8_t* pool_memory[NUM_FRAME_POOLS];
+
+struct frame_pool_stats frame_pool_stats[NUM_FRAME_POOLS];
+
+void frame_arena_reset(void) {
+    for (int pool = 0; pool < NUM_FRAME_POOLS; ++pool)
+        frame_pool_stats[pool].used = 0;
+}
+
+int frame_pool_reserve(enum frame_pool pool, size_t size) {
+    struct frame_pool_stats* stats = &frame_pool_stats[pool];
+    size = ALIGN_SIZE(size);
+    if (size <= stats->capacity) return 1;
+    // Moving the pool would leave earlier allocations pointing at freed memory
+    if (stats->used != 0) {
+        ++stats->failures;
+        return 0;
+    }
+
+    // malloc rather than realloc, since nothing in an empty pool needs copying
+    uint8_t* memory = (uint8_t*)malloc(size);
+    if (memory == NULL) {
+        ++stats->failures;
+        return 0;
+    }
+    free(pool_memory[pool]);
+    pool_memory[pool] = memory;
+    stats->capacity = size;
+    return 1;
+}
+
+void* frame_pool_alloc(enum frame_pool pool, size_t size) {
+    struct frame_pool_stats* stats = &frame_pool_stats[pool];
+    size = ALIGN_SIZE(size);
+    if (size > stats->capacity - stats->used) {
+        ++stats->failures;
+        return NULL;
+    }
+
+    void* ptr = pool_memory[pool] + stats->used;
+    stats->used += size;
+    if (stats->used > stats->high_water)
+        stats->high_water = stats->used;
+    ++stats->allocations;
+    return ptr;
+}
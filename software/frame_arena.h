@@ -0,0 +1,49 @@
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define FRAME_ARENA_ALIGN 8
+
+/**
+ * Scratch memory is split into pools by use, so one kind of buffer growing
+ * can't starve the others. Every pool is a bump allocator that is emptied by
+ * frame_arena_reset. Pools start empty and are sized from the frame with
+ * frame_pool_reserve, so they only ever hold as much as the largest frame so far.
+ */
+enum frame_pool {
+    FRAME_POOL_DEPTH_TILES, // per-worker depth tiles
+    FRAME_POOL_TRIANGLES,   // binned triangles
+    FRAME_POOL_TILE_LISTS,  // per-tile triangle lists
+    NUM_FRAME_POOLS
+};
+
+struct frame_pool_stats {
+    size_t capacity;
+    size_t used;             // bytes allocated since the last reset
+    size_t high_water;       // most bytes ever in use at once
+    unsigned int allocations; // successful allocations since startup
+    unsigned int failures;    // allocations or reservations that didn't fit
+};
+
+extern struct frame_pool_stats frame_pool_stats[NUM_FRAME_POOLS];
+
+/** @brief Releases every allocation made since the last reset, in every pool. Call once per frame */
+void frame_arena_reset(void);
+
+/** @brief Grows an empty pool so that it holds at least size bytes
+ *  @param pool pool to grow
+ *  @param size number of bytes this frame needs from it
+ *  @return 1 if the pool now has room, 0 if it is in use or the heap is out of memory (it is left as it was)
+ */
+int frame_pool_reserve(enum frame_pool pool, size_t size);
+
+/** @brief Bump-allocates size bytes of scratch memory from a pool that lives until the next reset
+ *  @param pool pool to allocate from
+ *  @param size number of bytes to allocate
+ *  @return pointer to the memory, or NULL if the pool is exhausted
+ */
+void* frame_pool_alloc(enum frame_pool pool, size_t size);
+
+#endif
@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hardware/hardware.h"
+#include "software/greedy_mesh.h"
+#include "software/vector_math.h"
+
+struct mesh_quad* mesh_quads;
+unsigned int mesh_quad_count;
+
+static unsigned int mesh_quad_capacity;
+static unsigned int mesh_revision;
+static uint8_t mesh_valid;
+
+// Axis along each face's normal (0 = x, 1 = y, 2 = z) and whether it points to +inf
+static const uint8_t face_axis[NUM_FACES] = {
+    [FACE_FRONT] = 2, [FACE_BACK] = 2,
+    [FACE_TOP] = 1, [FACE_BOTTOM] = 1,
+    [FACE_LEFT] = 0, [FACE_RIGHT] = 0,
+};
+static const uint8_t face_positive[NUM_FACES] = {
+    [FACE_FRONT] = 1, [FACE_BOTTOM] = 1, [FACE_RIGHT] = 1,
+};
+
+static int compare_int(int a, int b) {
+    return (a > b) - (a < b);
+}
+
+// Orders unit faces by plane, then row by row along v and u
+static int compare_plane_order(const void* pa, const void* pb) {
+    const struct mesh_quad* a = pa;
+    const struct mesh_quad* b = pb;
+    int c;
+    if ((c = compare_int(a->face, b->face))) return c;
+    if ((c = compare_int(a->plane, b->plane))) return c;
+    if ((c = compare_int(a->v0, b->v0))) return c;
+    return compare_int(a->u0, b->u0);
+}
+
+static int same_plane(const struct mesh_quad* a, const struct mesh_quad* b) {
+    return a->face == b->face && a->plane == b->plane;
+}
+
+// Palette of each unit face of the plane being merged, 0 where there is none
+static uint8_t* plane_mask;
+static unsigned int plane_mask_capacity;
+
+static void reserve_plane_mask(unsigned int cells) {
+    if (cells <= plane_mask_capacity) return;
+    plane_mask_capacity = cells;
+    plane_mask = (uint8_t*)realloc(plane_mask, plane_mask_capacity);
+    if (plane_mask == NULL) {
+        printf("Failed to allocate memory for mesh\n");
+        while (1);
+    }
+}
+
+/* Merges the unit faces faces[0..count) of one plane into rectangles, writing
+   them to out, which may overlap faces. Each rectangle grows along u as far as
+   it can, then along v while every cell of the next row matches, so no
+   rectangle can be grown any further. Returns the number of rectangles */
+static unsigned int merge_plane(const struct mesh_quad* faces, unsigned int count, struct mesh_quad* out) {
+    int u_min = faces[0].u0, u_max = faces[0].u0;
+    int v_min = faces[0].v0, v_max = faces[count - 1].v0;
+    for (unsigned int i = 1; i < count; ++i) {
+        if (faces[i].u0 < u_min) u_min = faces[i].u0;
+        if (faces[i].u0 > u_max) u_max = faces[i].u0;
+    }
+    int width = u_max - u_min + 1, height = v_max - v_min + 1;
+    reserve_plane_mask(width * height);
+    memset(plane_mask, 0, width * height);
+    for (unsigned int i = 0; i < count; ++i)
+        plane_mask[(faces[i].v0 - v_min) * width + faces[i].u0 - u_min] = faces[i].palette;
+
+    struct mesh_quad first = faces[0];
+    unsigned int rects = 0;
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+            uint8_t palette = plane_mask[v * width + u];
+            if (palette == 0) continue;
+            int u_end = u + 1;
+            while (u_end < width && plane_mask[v * width + u_end] == palette) ++u_end;
+            int v_end = v + 1;
+            while (v_end < height) {
+                int row = u;
+                while (row < u_end && plane_mask[v_end * width + row] == palette) ++row;
+                if (row < u_end) break;
+                ++v_end;
+            }
+            for (int dv = v; dv < v_end; ++dv)
+                memset(&plane_mask[dv * width + u], 0, u_end - u);
+            out[rects++] = (struct mesh_quad){
+                .face = first.face,
+                .palette = palette,
+                .plane = first.plane,
+                .u0 = u + u_min, .v0 = v + v_min,
+                .u1 = u_end + u_min, .v1 = v_end + v_min,
+            };
+            u = u_end - 1;
+        }
+    }
+    return rects;
+}
+
+static void reserve_quads(unsigned int count) {
+    if (count <= mesh_quad_capacity) return;
+    mesh_quad_capacity = count;
+    mesh_quads = (struct mesh_quad*)realloc(mesh_quads, mesh_quad_capacity * sizeof(struct mesh_quad));
+    if (mesh_quads == NULL) {
+        printf("Failed to allocate memory for mesh\n");
+        while (1);
+    }
+}
+
+unsigned int update_greedy_mesh(void) {
+    if (mesh_valid && mesh_revision == voxel_revision)
+        return mesh_quad_count;
+
+    /* one unit quad per exposed face */
+    unsigned int face_count = 0;
+    for (unsigned int i = 0; i < voxel_count; ++i) {
+        if (voxel_space[i].voxel_id != 0)
+            face_count += __builtin_popcount(voxel_faces[i]);
+    }
+    reserve_quads(face_count);
+
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < voxel_count; ++i) {
+        if (voxel_space[i].voxel_id == 0) continue;
+        int pos[3] = {voxel_space[i].x, voxel_space[i].y, voxel_space[i].z};
+        for (int face = 0; face < NUM_FACES; ++face) {
+            if (!((voxel_faces[i] >> face) & 0b1)) continue;
+            int axis = face_axis[face];
+            int u_axis = axis == 0 ? 1 : 0;
+            int v_axis = axis == 2 ? 1 : 2;
+            mesh_quads[count++] = (struct mesh_quad){
+                .face = face,
+                .palette = voxel_space[i].voxel_id,
+                .plane = pos[axis] + face_positive[face],
+                .u0 = pos[u_axis], .v0 = pos[v_axis],
+                .u1 = pos[u_axis] + 1, .v1 = pos[v_axis] + 1,
+            };
+        }
+    }
+
+    /* merge each plane on its own; a plane never yields more rectangles
+       than it has faces, so they can overwrite the faces already merged */
+    qsort(mesh_quads, count, sizeof(struct mesh_quad), compare_plane_order);
+    unsigned int merged = 0;
+    for (unsigned int start = 0, end; start < count; start = end) {
+        for (end = start + 1; end < count && same_plane(&mesh_quads[start], &mesh_quads[end]); ++end);
+        merged += merge_plane(&mesh_quads[start], end - start, &mesh_quads[merged]);
+    }
+    count = merged;
+
+    mesh_quad_count = count;
+    mesh_revision = voxel_revision;
+    mesh_valid = 1;
+    return mesh_quad_count;
+}
+
+struct Vector quad_corner(const struct mesh_quad* quad, float u, float v) {
+    switch (face_axis[quad->face]) {
+        case 0: return (struct Vector){quad->plane, u, v};
+        case 1: return (struct Vector){u, quad->plane, v};
+        default: return (struct Vector){u, v, quad->plane};
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef GREEDY_MESH_H
+#define GREEDY_MESH_H
+
+#include <stdint.h>
+#include "firmware/firmware.h"
+#include "software/vector_math.h"
+
+/**
+ * A rectangle of coplanar, same-palette exposed voxel faces.
+ * The face lies on the plane `plane` of its normal axis and covers
+ * [u0, u1) x [v0, v1) of the two remaining axes, taken in x, y, z order
+ * (so u is x unless the normal is x, and v is z unless the normal is z).
+ */
+struct mesh_quad {
+    uint8_t face; // enum voxel_face
+    uint8_t palette;
+    int16_t plane;
+    int16_t u0, v0;
+    int16_t u1, v1;
+};
+
+extern struct mesh_quad* mesh_quads;
+extern unsigned int mesh_quad_count;
+
+/** @brief Rebuilds mesh_quads from the exposed faces of voxel_space, but only if
+ *  the voxel space changed since the last build. Each plane is merged greedily,
+ *  growing every rectangle along u and then v until it cannot grow any further
+ *  @return number of quads in the mesh
+ */
+unsigned int update_greedy_mesh(void);
+
+/** @brief Returns the world-space point (u, v) of a quad's plane */
+struct Vector quad_corner(const struct mesh_quad* quad, float u, float v);
+
+#endif
@@ -2,6 +2,8 @@
 #include "firmware/interrupts.h"
 #include "software/external.h"
 #include "firmware/firmware.h"
+#include "firmware/world.h"
+#include "firmware/edit_journal.h"
 #include "model-headers/skyblock.h"
 
 int main(void) {
@@ -21,6 +23,8 @@ int main(void) {
     struct Vector camLook = {-1, 0, 0};
     struct Vector camUp = {0, 1, 0};
     set_camera_default(camPos, camLook, camUp);
+    // the crosshair's pixel, for get_target_voxel
+    set_pick_pixel(H_RESOLUTION / 2, V_RESOLUTION / 2);
     // set_camera_default_software(camPos, camLook, camUp);
 
     // Setting up voxels
@@ -40,7 +44,7 @@ int main(void) {
     // set_voxel((v_pos){-2,-2,-2}, 3);
     // set_voxel((v_pos){34, 32, 32}, 1);
     // load_monkey();
-    load_skyblock();
+    world_load_voxels(skyblock_voxels, sizeof(skyblock_voxels) / sizeof(skyblock_voxels[0]), (w_pos){0, 0, 0});
     // clear_screen_software();
     // wait_for_vsync_software(); // wait_for_vsync();
 
@@ -54,14 +58,14 @@ int main(void) {
         if (enter_key_pressed)
         {
             sprintf(hex, "Enter detected");
-            int16_t target_x, target_y, target_z;
+            int32_t target_x, target_y, target_z;
 
             if (get_target_voxel(&target_x, &target_y, &target_z))
             {
-                v_pos new_voxel_pos = {target_x, target_y, target_z};
-                set_voxel(new_voxel_pos, 1);
+                w_pos new_voxel_pos = {target_x, target_y, target_z};
+                queue_voxel_edit(new_voxel_pos, 1);
 
-                len = sprintf(hex, "Placed voxel at (%d %d %d)", target_x, target_y, target_z);
+                len = sprintf(hex, "Placed voxel at (%ld %ld %ld)", (long)target_x, (long)target_y, (long)target_z);
                 // printf("Voxel placed at: %d, %d, %d\n", target_x, target_y, target_z); // Comment out later
             }
 
@@ -0,0 +1,285 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hardware/hardware.h"
+#include "software/occupancy.h"
+#include "firmware/edit_journal.h"
+
+struct occupancy_grid occupancy;
+
+static unsigned int brick_capacity;
+static unsigned int occupancy_revision;
+static uint8_t occupancy_valid;
+
+static inline int brick_index(int bx, int by, int bz) {
+    return (bz * occupancy.bricks_y + by) * occupancy.bricks_x + bx;
+}
+
+static inline int brick_occupied(int index) {
+    return (occupancy.summary[index >> 3] >> (index & 7)) & 0b1;
+}
+
+static inline int voxel_bit(int x, int y) {
+    return ((y & (BRICK_SIZE - 1)) << BRICK_SHIFT) | (x & (BRICK_SIZE - 1));
+}
+
+static struct occupancy_brick* add_brick(int index) {
+    if (occupancy.brick_count == 0xFFFF) {
+        printf("Too many bricks for occupancy grid\n");
+        while (1);
+    }
+    if (occupancy.brick_count == brick_capacity) {
+        brick_capacity = brick_capacity ? brick_capacity * 2 : 64;
+        occupancy.bricks = (struct occupancy_brick*)realloc(occupancy.bricks, brick_capacity * sizeof(struct occupancy_brick));
+        if (occupancy.bricks == NULL) {
+            printf("Failed to allocate memory for occupancy bricks\n");
+            while (1);
+        }
+    }
+    struct occupancy_brick* brick = &occupancy.bricks[occupancy.brick_count];
+    memset(brick, 0, sizeof(struct occupancy_brick));
+    occupancy.directory[index] = occupancy.brick_count++;
+    occupancy.summary[index >> 3] |= 1 << (index & 7);
+    return brick;
+}
+
+static void store_voxel(struct occupancy_brick* brick, int x, int y, int z, uint8_t palette) {
+    uint64_t bit = (uint64_t)1 << voxel_bit(x, y);
+    int row = z & (BRICK_SIZE - 1);
+    brick->occupied[row] &= ~bit;
+    brick->palette_lo[row] &= ~bit;
+    brick->palette_hi[row] &= ~bit;
+    if (palette == 0) return;
+    brick->occupied[row] |= bit;
+    if (palette & 0b01) brick->palette_lo[row] |= bit;
+    if (palette & 0b10) brick->palette_hi[row] |= bit;
+}
+
+// Past this many voxels, walking the dirty box costs about as much as a rebuild
+#define PATCH_MAX_VOXELS 32768
+
+/* Rewrites just the voxels in voxel_dirty_box, or returns 0 without touching
+   the grid if they reach outside it. Bricks emptied by removals stay allocated */
+static int patch_occupancy(void) {
+    const struct voxel_dirty_box* box = &voxel_dirty_box;
+    if (box->min.x > box->max.x || box->min.y > box->max.y || box->min.z > box->max.z) return 1;
+    int lo[3] = {box->min.x - occupancy.origin_x, box->min.y - occupancy.origin_y, box->min.z - occupancy.origin_z};
+    int hi[3] = {box->max.x - occupancy.origin_x, box->max.y - occupancy.origin_y, box->max.z - occupancy.origin_z};
+    int bricks[3] = {occupancy.bricks_x, occupancy.bricks_y, occupancy.bricks_z};
+    long volume = 1;
+    for (int a = 0; a < 3; ++a) {
+        if (lo[a] < 0 || hi[a] >= bricks[a] << BRICK_SHIFT) return 0;
+        volume *= hi[a] - lo[a] + 1;
+    }
+    if (volume > PATCH_MAX_VOXELS) return 0;
+
+    for (int z = lo[2]; z <= hi[2]; ++z)
+        for (int y = lo[1]; y <= hi[1]; ++y)
+            for (int x = lo[0]; x <= hi[0]; ++x) {
+                uint8_t palette = get_voxel((v_pos){x + occupancy.origin_x, y + occupancy.origin_y, z + occupancy.origin_z});
+                int index = brick_index(x >> BRICK_SHIFT, y >> BRICK_SHIFT, z >> BRICK_SHIFT);
+                if (!brick_occupied(index)) {
+                    if (palette == 0) continue;
+                    add_brick(index);
+                }
+                store_voxel(&occupancy.bricks[occupancy.directory[index]], x, y, z, palette);
+            }
+    return 1;
+}
+
+int occupancy_current(void) {
+    if (!occupancy_valid) return 0;
+    if (occupancy_revision == voxel_revision) return 1;
+    if (!voxel_edits_cover(occupancy_revision) || !patch_occupancy()) return 0;
+    occupancy_revision = voxel_revision;
+    return 1;
+}
+
+unsigned int update_occupancy(void) {
+    if (occupancy_current())
+        return occupancy.brick_count;
+    occupancy_valid = 1;
+    occupancy_revision = voxel_revision;
+    occupancy.brick_count = 0;
+
+    /* bounding box of the occupied voxels, widened to whole bricks */
+    int lo[3] = {0, 0, 0}, hi[3] = {-1, -1, -1};
+    int any = 0;
+    for (unsigned int i = 0; i < voxel_count; ++i) {
+        if (voxel_space[i].voxel_id == 0) continue;
+        int pos[3] = {voxel_space[i].x, voxel_space[i].y, voxel_space[i].z};
+        for (int a = 0; a < 3; ++a) {
+            if (!any || pos[a] < lo[a]) lo[a] = pos[a];
+            if (!any || pos[a] > hi[a]) hi[a] = pos[a];
+        }
+        any = 1;
+    }
+    for (int a = 0; a < 3; ++a)
+        lo[a] &= ~(BRICK_SIZE - 1);
+    occupancy.origin_x = lo[0];
+    occupancy.origin_y = lo[1];
+    occupancy.origin_z = lo[2];
+    occupancy.bricks_x = any ? ((hi[0] - lo[0]) >> BRICK_SHIFT) + 1 : 0;
+    occupancy.bricks_y = any ? ((hi[1] - lo[1]) >> BRICK_SHIFT) + 1 : 0;
+    occupancy.bricks_z = any ? ((hi[2] - lo[2]) >> BRICK_SHIFT) + 1 : 0;
+
+    int total = occupancy.bricks_x * occupancy.bricks_y * occupancy.bricks_z;
+    free(occupancy.summary);
+    free(occupancy.directory);
+    occupancy.summary = (uint8_t*)calloc((total + 7) / 8 + 1, sizeof(uint8_t));
+    occupancy.directory = (uint16_t*)malloc((total + 1) * sizeof(uint16_t));
+    if (occupancy.summary == NULL || occupancy.directory == NULL) {
+        printf("Failed to allocate memory for occupancy grid\n");
+        while (1);
+    }
+
+    /* later entries of voxel_space override earlier ones at the same position */
+    for (unsigned int i = 0; i < voxel_count; ++i) {
+        if (voxel_space[i].voxel_id == 0) continue;
+        int x = voxel_space[i].x - lo[0];
+        int y = voxel_space[i].y - lo[1];
+        int z = voxel_space[i].z - lo[2];
+        int index = brick_index(x >> BRICK_SHIFT, y >> BRICK_SHIFT, z >> BRICK_SHIFT);
+        struct occupancy_brick* brick = brick_occupied(index)
+            ? &occupancy.bricks[occupancy.directory[index]]
+            : add_brick(index);
+
+        store_voxel(brick, x, y, z, voxel_space[i].voxel_id);
+    }
+    return occupancy.brick_count;
+}
+
+static inline uint8_t brick_palette(const struct occupancy_brick* brick, int x, int y, int z) {
+    int bit = voxel_bit(x, y), row = z & (BRICK_SIZE - 1);
+    return ((brick->palette_lo[row] >> bit) & 0b1) | (((brick->palette_hi[row] >> bit) & 0b1) << 1);
+}
+
+uint8_t occupancy_palette(int x, int y, int z) {
+    x -= occupancy.origin_x;
+    y -= occupancy.origin_y;
+    z -= occupancy.origin_z;
+    if (x < 0 || y < 0 || z < 0) return 0;
+    int bx = x >> BRICK_SHIFT, by = y >> BRICK_SHIFT, bz = z >> BRICK_SHIFT;
+    if (bx >= occupancy.bricks_x || by >= occupancy.bricks_y || bz >= occupancy.bricks_z) return 0;
+
+    int index = brick_index(bx, by, bz);
+    if (!brick_occupied(index)) return 0;
+    const struct occupancy_brick* brick = &occupancy.bricks[occupancy.directory[index]];
+    if (!((brick->occupied[z & (BRICK_SIZE - 1)] >> voxel_bit(x, y)) & 0b1)) return 0;
+    return brick_palette(brick, x, y, z);
+}
+
+// State of a ray in grid-relative coordinates, shared by both levels of the DDA
+struct grid_ray {
+    float origin[3];
+    float dir[3];
+    float inv_dir[3];
+    int step[3];
+};
+
+/* Steps voxel by voxel through one brick, starting at distance t where the ray
+   entered it through axis. Returns 1 and fills hit on the first occupied voxel. */
+static int march_brick(
+    const struct grid_ray* ray, int index, const int brick[3],
+    float t, int axis, struct occupancy_hit* hit
+) {
+    const struct occupancy_brick* bits = &occupancy.bricks[occupancy.directory[index]];
+    int base[3], cell[3];
+    float t_max[3], t_delta[3];
+    for (int a = 0; a < 3; ++a) {
+        base[a] = brick[a] << BRICK_SHIFT;
+        // the entry point can round just outside the brick, so clamp it back in
+        int c = floor_to_int(ray->origin[a] + ray->dir[a] * t) - base[a];
+        cell[a] = c < 0 ? 0 : c >= BRICK_SIZE ? BRICK_SIZE - 1 : c;
+        if (ray->step[a] == 0) {
+            t_max[a] = NO_CROSSING;
+            t_delta[a] = NO_CROSSING;
+        } else {
+            int boundary = base[a] + cell[a] + (ray->step[a] > 0);
+            t_max[a] = (boundary - ray->origin[a]) * ray->inv_dir[a];
+            t_delta[a] = fabsf(ray->inv_dir[a]);
+        }
+    }
+
+    while (1) {
+        uint64_t row = bits->occupied[cell[2]];
+        if (((row >> voxel_bit(cell[0], cell[1])) & 0b1) && t > 0 && axis >= 0) {
+            hit->t = t;
+            hit->pos = (v_pos){
+                base[0] + cell[0] + occupancy.origin_x,
+                base[1] + cell[1] + occupancy.origin_y,
+                base[2] + cell[2] + occupancy.origin_z,
+            };
+            hit->palette = brick_palette(bits, cell[0], cell[1], cell[2]);
+            hit->face = entry_face(axis, ray->step[axis]);
+            return 1;
+        }
+
+        axis = min_axis(t_max);
+        t = t_max[axis];
+        cell[axis] += ray->step[axis];
+        if (cell[axis] < 0 || cell[axis] >= BRICK_SIZE) return 0;
+        t_max[axis] += t_delta[axis];
+    }
+}
+
+int occupancy_raycast(const struct Vector* origin, const struct Vector* dir, struct occupancy_hit* hit) {
+    if (occupancy.brick_count == 0) return 0;
+
+    int bricks[3] = {occupancy.bricks_x, occupancy.bricks_y, occupancy.bricks_z};
+    struct grid_ray ray = {
+        .origin = {origin->x - occupancy.origin_x, origin->y - occupancy.origin_y, origin->z - occupancy.origin_z},
+        .dir = {dir->x, dir->y, dir->z},
+    };
+
+    /* clip the ray to the grid's bounding box, remembering the axis it enters through */
+    float t_enter = 0, t_exit = NO_CROSSING;
+    int axis = -1;
+    for (int a = 0; a < 3; ++a) {
+        float size = bricks[a] << BRICK_SHIFT;
+        if (ray.dir[a] == 0) {
+            if (ray.origin[a] < 0 || ray.origin[a] >= size) return 0;
+            ray.inv_dir[a] = NO_CROSSING;
+            ray.step[a] = 0;
+            continue;
+        }
+        ray.inv_dir[a] = 1 / ray.dir[a];
+        ray.step[a] = ray.dir[a] > 0 ? 1 : -1;
+        float t0 = (0 - ray.origin[a]) * ray.inv_dir[a];
+        float t1 = (size - ray.origin[a]) * ray.inv_dir[a];
+        if (t0 > t1) { float swap = t0; t0 = t1; t1 = swap; }
+        if (t0 > t_enter) { t_enter = t0; axis = a; }
+        if (t1 < t_exit) t_exit = t1;
+    }
+    if (t_enter >= t_exit) return 0;
+
+    /* coarse DDA over whole bricks */
+    int brick[3];
+    float t_max[3], t_delta[3];
+    for (int a = 0; a < 3; ++a) {
+        int b = floor_to_int(ray.origin[a] + ray.dir[a] * t_enter) >> BRICK_SHIFT;
+        brick[a] = b < 0 ? 0 : b >= bricks[a] ? bricks[a] - 1 : b;
+        if (ray.step[a] == 0) {
+            t_max[a] = NO_CROSSING;
+            t_delta[a] = NO_CROSSING;
+        } else {
+            int boundary = (brick[a] + (ray.step[a] > 0)) << BRICK_SHIFT;
+            t_max[a] = (boundary - ray.origin[a]) * ray.inv_dir[a];
+            t_delta[a] = BRICK_SIZE * fabsf(ray.inv_dir[a]);
+        }
+    }
+
+    float t = t_enter;
+    while (1) {
+        int index = brick_index(brick[0], brick[1], brick[2]);
+        if (brick_occupied(index) && march_brick(&ray, index, brick, t, axis, hit))
+            return 1;
+
+        axis = min_axis(t_max);
+        t = t_max[axis];
+        brick[axis] += ray.step[axis];
+        if (brick[axis] < 0 || brick[axis] >= bricks[axis]) return 0;
+        t_max[axis] += t_delta[axis];
+    }
+}
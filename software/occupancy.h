@@ -0,0 +1,95 @@
+#ifndef OCCUPANCY_H
+#define OCCUPANCY_H
+
+#include <stdint.h>
+#include "firmware/firmware.h"
+#include "software/vector_math.h"
+
+#define BRICK_SHIFT 3
+#define BRICK_SIZE (1 << BRICK_SHIFT)
+
+/**
+ * One bit per voxel of an 8x8x8 brick, plus its 2-bit palette split over two planes.
+ * Word z of each plane holds the z-th slice, with bit y * 8 + x for voxel (x, y).
+ */
+struct occupancy_brick {
+    uint64_t occupied[BRICK_SIZE];
+    uint64_t palette_lo[BRICK_SIZE];
+    uint64_t palette_hi[BRICK_SIZE];
+};
+
+/**
+ * Dense occupancy over the bounding box of the voxel space, split into bricks.
+ * Only bricks holding a voxel are stored; every other brick is a cleared summary bit.
+ */
+struct occupancy_grid {
+    int16_t origin_x, origin_y, origin_z; // voxel position of brick (0, 0, 0)
+    int bricks_x, bricks_y, bricks_z;
+    uint8_t* summary;     // one bit per brick, set if any voxel in it is occupied
+    uint16_t* directory;  // index into bricks of each occupied brick
+    struct occupancy_brick* bricks;
+    unsigned int brick_count;
+};
+
+/** @brief Where a ray first enters an occupied voxel */
+struct occupancy_hit {
+    float t;         // distance along the ray, in units of its direction
+    v_pos pos;       // voxel that was hit
+    uint8_t palette;
+    uint8_t face;    // enum voxel_face the ray entered through
+};
+
+// Stands in for 1/0 on axes the ray doesn't move along, so their boundaries are never reached
+#define NO_CROSSING 1e30f
+
+// Face a ray crosses when it steps into a voxel along axis in direction step
+static inline uint8_t entry_face(int axis, int step) {
+    static const uint8_t faces[3][2] = {
+        {FACE_RIGHT, FACE_LEFT},
+        {FACE_BOTTOM, FACE_TOP},
+        {FACE_FRONT, FACE_BACK},
+    };
+    return faces[axis][step > 0];
+}
+
+// floorf without the libm call
+static inline int floor_to_int(float x) {
+    int i = (int)x;
+    return i - (x < i);
+}
+
+static inline int min_axis(const float t[3]) {
+    if (t[0] < t[1]) return t[0] < t[2] ? 0 : 2;
+    return t[1] < t[2] ? 1 : 2;
+}
+
+extern struct occupancy_grid occupancy;
+
+/** @brief Brings the occupancy grid up to date if that needs no rebuild: either
+ *  nothing changed since the last build, or every change was a journaled edit
+ *  that can be patched in
+ *  @return 1 if the grid now matches voxel_space, 0 if only a rebuild would
+ */
+int occupancy_current(void);
+
+/** @brief Rebuilds the occupancy grid from voxel_space, but only if the voxel space
+ *  changed since the last build. If every change since then came from journaled edits
+ *  inside the grid, only the voxels in voxel_dirty_box are rewritten
+ *  @return number of occupied bricks
+ */
+unsigned int update_occupancy(void);
+
+/** @brief Returns the palette of the voxel at (x, y, z), or 0 if it is empty */
+uint8_t occupancy_palette(int x, int y, int z);
+
+/** @brief Walks a ray through the occupancy grid with a two-level Amanatides-Woo DDA,
+ *  skipping empty bricks whole and stepping voxel by voxel inside occupied ones.
+ *  The voxel the ray starts in is never reported, just as faces seen from behind aren't drawn.
+ *  @param origin start of the ray
+ *  @param dir direction of the ray, which need not be normalized
+ *  @param hit filled in with the first occupied voxel along the ray
+ *  @return 1 if the ray hit a voxel, 0 if it left the grid
+ */
+int occupancy_raycast(const struct Vector* origin, const struct Vector* dir, struct occupancy_hit* hit);
+
+#endif
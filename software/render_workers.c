@@ -0,0 +1,98 @@
+#include <stdint.h>
+#include "software/render_workers.h"
+
+#if defined(__unix__)
+#include <pthread.h>
+#endif
+
+static int worker_count = DEFAULT_RENDER_WORKERS;
+static int item_count;
+static volatile int next_item;
+
+void set_render_workers(int count) {
+    if (count < 1) count = 1;
+    if (count > MAX_RENDER_WORKERS) count = MAX_RENDER_WORKERS;
+    worker_count = count;
+}
+
+int get_render_workers(void) {
+    return worker_count;
+}
+
+#if defined(__unix__)
+
+// Threads are kept alive between frames and parked on a barrier
+static pthread_t threads[MAX_RENDER_WORKERS];
+static pthread_barrier_t job_start, job_done;
+static int thread_count = 1;
+static void (*current_job)(int);
+static int stop_threads;
+
+static void* worker_thread(void* arg) {
+    int worker = (int)(intptr_t)arg;
+    while (1) {
+        pthread_barrier_wait(&job_start);
+        if (stop_threads) return NULL;
+        current_job(worker);
+        pthread_barrier_wait(&job_done);
+    }
+}
+
+static void resize_thread_pool(int count) {
+    if (thread_count > 1) {
+        stop_threads = 1;
+        pthread_barrier_wait(&job_start);
+        for (int i = 1; i < thread_count; i++)
+            pthread_join(threads[i], NULL);
+        pthread_barrier_destroy(&job_start);
+        pthread_barrier_destroy(&job_done);
+        stop_threads = 0;
+    }
+
+    thread_count = count;
+    if (count > 1) {
+        pthread_barrier_init(&job_start, NULL, count);
+        pthread_barrier_init(&job_done, NULL, count);
+        for (int i = 1; i < count; i++)
+            pthread_create(&threads[i], NULL, worker_thread, (void*)(intptr_t)i);
+    }
+}
+
+void run_render_workers(void (*job)(int worker), int items) {
+    if (thread_count != worker_count)
+        resize_thread_pool(worker_count);
+
+    item_count = items;
+    next_item = 0;
+    if (thread_count == 1) {
+        job(0);
+        return;
+    }
+
+    // Barriers order these writes before the workers start and theirs before we return
+    current_job = job;
+    pthread_barrier_wait(&job_start);
+    job(0);
+    pthread_barrier_wait(&job_done);
+}
+
+int claim_work_item(int worker) {
+    (void)worker;
+    int item = __atomic_fetch_add(&next_item, 1, __ATOMIC_RELAXED);
+    return item < item_count ? item : -1;
+}
+
+#else
+
+void run_render_workers(void (*job)(int worker), int items) {
+    item_count = items;
+    next_item = 0;
+    job(0);
+}
+
+int claim_work_item(int worker) {
+    (void)worker;
+    return next_item < item_count ? next_item++ : -1;
+}
+
+#endif
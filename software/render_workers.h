@@ -0,0 +1,33 @@
+#ifndef RENDER_WORKERS_H
+#define RENDER_WORKERS_H
+
+// Host builds run workers on pthreads; the board renders every tile on core 0
+#if defined(__unix__)
+#define MAX_RENDER_WORKERS 16
+#else
+#define MAX_RENDER_WORKERS 1
+#endif
+
+#define DEFAULT_RENDER_WORKERS 1
+
+/** @brief Sets how many workers render_software splits its tiles over (clamped to 1..MAX_RENDER_WORKERS)
+ *  @param count number of workers, including the calling thread
+ */
+void set_render_workers(int count);
+
+/** @brief Number of workers jobs are currently run on */
+int get_render_workers(void);
+
+/** @brief Runs job(worker) on every worker, the caller being worker 0, and returns once all have finished
+ *  @param job function run by each worker, which should take its items from claim_work_item
+ *  @param items number of work items shared between the workers
+ */
+void run_render_workers(void (*job)(int worker), int items);
+
+/** @brief Takes the next unclaimed work item, so workers that finish early pick up the remaining ones
+ *  @param worker index of the calling worker
+ *  @return item index, or -1 once every item has been claimed
+ */
+int claim_work_item(int worker);
+
+#endif
@@ -1,22 +1,29 @@
 #include <math.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include "software/software_render.h"
 #include "hardware/hardware.h"
 #include "firmware/firmware.h"
 #include "firmware/palette.h"
+#include "firmware/edit_journal.h"
 #include "software/debug.h"
+#include "software/frame_arena.h"
+#include "software/greedy_mesh.h"
+#include "software/occupancy.h"
+#include "software/render_workers.h"
 
 #define H_RESOLUTION 320
 #define V_RESOLUTION 240
 
+struct software_render_stats software_render_stats;
+
 static struct Camera camera;
+static enum software_render_mode render_mode = SOFTWARE_RENDER_RASTER;
 static float clip_plane_x, clip_plane_y;
 static float focal_length;
 unsigned char* pixel_buffer_software;
 unsigned char* char_buffer_software;
 
-typedef struct { int x, y; } Point;
-
 void setup_pixel_buffer_software() {
     pixel_buffer_software = PIXEL_BUF_CTRL->buffer;
     char_buffer_software = CHAR_BUF_CTRL->buffer;
@@ -50,6 +57,10 @@ void set_camera_default_software(struct Vector pos, struct Vector look, struct V
 
 }
 
+void set_render_mode_software(enum software_render_mode mode) {
+    render_mode = mode;
+}
+
 void set_camera_software(struct Camera* cam) {
     camera.look = cam->look;
     camera.pos = cam->pos;
@@ -139,78 +150,6 @@ float check_box_intersection(const uint8_t xp, const uint8_t yp, const uint8_t z
 }
 
 
-// Recursive partitioning and flood fill for voxel hits
-// Returns 1 if a hit was found and filled, 0 otherwise
-typedef struct { int x0, y0, x1, y1; } Partition;
-
-static int partition_and_fill(
-    int x0, int y0, int x1, int y1,
-    int voxel_x, int voxel_y, int voxel_z, uint8_t palette,
-    struct Ray* cameraRay,
-    struct Vector* topLeft, struct Vector* horizontalVec, struct Vector* verticalVec,
-    uint8_t* t_tracker, const uint16_t* palette_data
-) {
-    int q_start = 0, q_end = 0;
-    int found = 0;
-    int cx = 0, cy = 0;
-
-    Partition* queue = (Partition*)malloc(H_RESOLUTION * V_RESOLUTION * sizeof(Partition));
-    queue[q_end++] = (Partition){x0, y0, x1, y1};
-    while (!found && q_start < q_end) {
-        Partition part = queue[q_start++];
-        if (part.x0 > part.x1 || part.y0 > part.y1) continue;
-        cx = (part.x0 + part.x1) / 2;
-        cy = (part.y0 + part.y1) / 2;
-        cameraRay->direction = add_vector(add_vector(*topLeft, multiply_vector(*horizontalVec, cx)), multiply_vector(*verticalVec, V_RESOLUTION-1 - cy));
-        float t = check_box_intersection(voxel_x, voxel_y, voxel_z, cameraRay);
-        if (t == -1) {
-            // No hit, subdivide if possible
-            if (part.x0 == part.x1 && part.y0 == part.y1) continue;
-            int mx = (part.x0 + part.x1) / 2;
-            int my = (part.y0 + part.y1) / 2;
-            if (part.x0 < part.x1 || part.y0 < part.y1) {
-                queue[q_end++] = (Partition){part.x0, part.y0, mx, my};
-                queue[q_end++] = (Partition){mx+1, part.y0, part.x1, my};
-                queue[q_end++] = (Partition){part.x0, my+1, mx, part.y1};
-                queue[q_end++] = (Partition){mx+1, my+1, part.x1, part.y1};
-            }
-            continue;
-        } else {
-            found = 1;
-        }
-    }
-    free(queue);
-
-    if(!found)
-        return 0;
-
-    // If hit, flood fill within this section (across the whole screen)
-    Point* stack = (Point*)malloc(H_RESOLUTION * V_RESOLUTION * sizeof(Point));
-    int stack_size = 0;
-    stack[stack_size++] = (Point){cx, cy};
-    while (stack_size > 0) {
-        Point p = stack[--stack_size];
-        int xs = p.x, ys = p.y;
-        if (xs < 0 || xs >= H_RESOLUTION || ys < 0 || ys >= V_RESOLUTION)
-            continue;
-        int idx = xs * V_RESOLUTION + ys;
-        if (t_tracker[idx] != 0)
-            continue;
-        cameraRay->direction = add_vector(add_vector(*topLeft, multiply_vector(*horizontalVec, xs)), multiply_vector(*verticalVec, V_RESOLUTION-1 - ys));
-        float t2 = check_box_intersection(voxel_x, voxel_y, voxel_z, cameraRay);
-        if (t2 == -1)
-            continue;
-        t_tracker[idx] = t2;
-        plot_pixel(xs, ys, palette_data[palette]);
-        stack[stack_size++] = (Point){xs+1, ys};
-        stack[stack_size++] = (Point){xs-1, ys};
-        stack[stack_size++] = (Point){xs, ys+1};
-        stack[stack_size++] = (Point){xs, ys-1};
-    }
-    free(stack);
-    return 1;
-}
-
 void draw_line(int x0, int y0, int x1, int y1, uint16_t color) {
     int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
     int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
@@ -225,30 +164,6 @@ void draw_line(int x0, int y0, int x1, int y1, uint16_t color) {
 }
 
 
-uint16_t get_pixel(int x, int y) {
-    return *(uint16_t *)(pixel_buffer_software + (y << 10) + (x << 1));
-}
-
-void flood_fill(int x, int y, uint16_t color) {
-    Point stack[H_RESOLUTION * V_RESOLUTION];
-    int stack_size = 0;
-    uint16_t target = get_pixel(x, y);
-    stack[stack_size++] = (Point){x, y};
-    while (stack_size > 0) {
-        Point p = stack[--stack_size];
-
-        if (p.x < 0 || p.x >= H_RESOLUTION || p.y < 0 || p.y >= V_RESOLUTION) continue;
-        if (get_pixel(p.x, p.y) != 0) continue;
-
-        plot_pixel(p.x, p.y, color);
-        stack[stack_size++] = (Point){p.x+1, p.y};
-        stack[stack_size++] = (Point){p.x-1, p.y};
-        stack[stack_size++] = (Point){p.x, p.y+1};
-        stack[stack_size++] = (Point){p.x, p.y-1};
-    }
-}
-
-
 const int faces[6][4] = {
     {0,1,3,2}, // front
     {4,5,7,6}, // back
@@ -267,7 +182,305 @@ const struct Vector normal[6] = {
     {1.0f, 0.0f, 0.0f}    // right
 };
 
+// Depth is stored as camera-space distance in 1/64 voxel units, so 16 bits
+// cover the whole SIDE_LEN of the voxel space
+#define DEPTH_FRACT_BITS 6
+#define DEPTH_CLEAR 0xFFFF
+#define NEAR_PLANE 0.05f
+#define MAX_CLIPPED_VERTICES 8
+
+typedef struct { float x, y, inv_z; } Projected;
+// A quad clipped by the near plane has at most 5 vertices, so splits into at most 3 triangles
+#define MAX_QUAD_TRIANGLES 3
+
+// The screen is split into tiles that are rasterized independently, each with its own depth
+#define TILE_SIZE 32
+#define TILES_X ((H_RESOLUTION + TILE_SIZE - 1) / TILE_SIZE)
+#define TILES_Y ((V_RESOLUTION + TILE_SIZE - 1) / TILE_SIZE)
+#define NUM_TILES (TILES_X * TILES_Y)
+
+// A projected triangle along with the range of tiles its bounding box covers
+struct binned_triangle {
+    Projected v[3];
+    float inv_area;
+    uint16_t color;
+    uint8_t tile_x0, tile_y0, tile_x1, tile_y1;
+};
+
+static struct binned_triangle* triangles;
+static unsigned int triangle_count, triangle_capacity;
+// Triangles of tile t are tile_triangles[tile_offsets[t]] up to tile_triangles[tile_offsets[t + 1]]
+static uint32_t tile_offsets[NUM_TILES + 1];
+static uint32_t* tile_triangles;
+// One TILE_SIZE x TILE_SIZE depth tile per worker
+static uint16_t* depth_tiles;
+static float frac_x_const, frac_y_const;
+
+// Takes this frame's triangle and depth tile storage from their frame arena pools,
+// growing them to fit max_triangles first
+static void begin_frame_software(unsigned int max_triangles) {
+    frame_arena_reset();
+    size_t depth_tile_size = get_render_workers() * TILE_SIZE * TILE_SIZE * sizeof(uint16_t);
+    frame_pool_reserve(FRAME_POOL_DEPTH_TILES, depth_tile_size);
+    depth_tiles = (uint16_t*)frame_pool_alloc(FRAME_POOL_DEPTH_TILES, depth_tile_size);
+    if (depth_tiles == NULL) {
+        printf("Failed to allocate memory for frame\n");
+        while (1);
+    }
+    // If the heap has no room for this many, clip the frame to what the pool held before
+    if (!frame_pool_reserve(FRAME_POOL_TRIANGLES, max_triangles * sizeof(struct binned_triangle)))
+        max_triangles = frame_pool_stats[FRAME_POOL_TRIANGLES].capacity / sizeof(struct binned_triangle);
+    triangle_capacity = max_triangles;
+    triangles = (struct binned_triangle*)frame_pool_alloc(FRAME_POOL_TRIANGLES, max_triangles * sizeof(struct binned_triangle));
+    triangle_count = 0;
+    for (int t = 0; t <= NUM_TILES; t++)
+        tile_offsets[t] = 0;
+
+    frac_x_const = focal_length / clip_plane_x;
+    frac_y_const = focal_length / clip_plane_y;
+}
+
+// x is along camera.right, y along camera.up and z along camera.look
+static struct Vector to_camera_space(const struct Vector p) {
+    struct Vector diff = sub_vector(p, camera.pos);
+    return (struct Vector){
+        diff.x * camera.right.x + diff.y * camera.right.y + diff.z * camera.right.z,
+        diff.x * camera.up.x + diff.y * camera.up.y + diff.z * camera.up.z,
+        diff.x * camera.look.x + diff.y * camera.look.y + diff.z * camera.look.z
+    };
+}
+
+static Projected project_vertex(const struct Vector* v) {
+    float inv_z = 1 / v->z;
+    Projected p;
+    p.x = ((v->x * frac_x_const) * inv_z + 1.0f) * (H_RESOLUTION >> 1);
+    p.y = (-(v->y * frac_y_const) * inv_z + 1.0f) * (V_RESOLUTION >> 1);
+    p.inv_z = inv_z;
+    return p;
+}
+
+static inline float edge_function(const Projected* a, const Projected* b, float px, float py) {
+    return (b->x - a->x) * (py - a->y) - (b->y - a->y) * (px - a->x);
+}
+
+// Queues a projected triangle and counts it in every tile its bounding box touches
+static void bin_triangle(const Projected* a, const Projected* b, const Projected* c, uint16_t color) {
+    float area = edge_function(a, b, c->x, c->y);
+    if (area == 0.0f) return;
+
+    float min_xf = my_fminf(a->x, my_fminf(b->x, c->x));
+    float max_xf = my_fmaxf(a->x, my_fmaxf(b->x, c->x));
+    float min_yf = my_fminf(a->y, my_fminf(b->y, c->y));
+    float max_yf = my_fmaxf(a->y, my_fmaxf(b->y, c->y));
+    if (max_xf < 0 || max_yf < 0 || min_xf >= H_RESOLUTION || min_yf >= V_RESOLUTION) return;
+    if (triangle_count == triangle_capacity) {
+        software_render_stats.clipped_triangles++;
+        return;
+    }
+
+    struct binned_triangle* tri = &triangles[triangle_count++];
+    tri->v[0] = *a;
+    tri->v[1] = *b;
+    tri->v[2] = *c;
+    tri->inv_area = 1 / area;
+    tri->color = color;
+    tri->tile_x0 = min_xf < 0 ? 0 : (int)min_xf / TILE_SIZE;
+    tri->tile_y0 = min_yf < 0 ? 0 : (int)min_yf / TILE_SIZE;
+    tri->tile_x1 = max_xf >= H_RESOLUTION - 1 ? TILES_X - 1 : (int)max_xf / TILE_SIZE;
+    tri->tile_y1 = max_yf >= V_RESOLUTION - 1 ? TILES_Y - 1 : (int)max_yf / TILE_SIZE;
+
+    for (int ty = tri->tile_y0; ty <= tri->tile_y1; ty++)
+        for (int tx = tri->tile_x0; tx <= tri->tile_x1; tx++)
+            tile_offsets[ty * TILES_X + tx + 1]++;
+}
+
+// Turns the per-tile counts into offsets and fills in each tile's triangle list
+static void build_tile_bins() {
+    size_t entries = 0;
+    for (int t = 0; t < NUM_TILES; t++)
+        entries += tile_offsets[t + 1];
+    if (!frame_pool_reserve(FRAME_POOL_TILE_LISTS, entries * sizeof(uint32_t))) {
+        // The heap has no room, so drop the last triangles binned until their lists fit the pool
+        size_t room = frame_pool_stats[FRAME_POOL_TILE_LISTS].capacity / sizeof(uint32_t);
+        while (entries > room) {
+            const struct binned_triangle* tri = &triangles[--triangle_count];
+            for (int ty = tri->tile_y0; ty <= tri->tile_y1; ty++)
+                for (int tx = tri->tile_x0; tx <= tri->tile_x1; tx++)
+                    tile_offsets[ty * TILES_X + tx + 1]--;
+            entries -= (tri->tile_x1 - tri->tile_x0 + 1) * (tri->tile_y1 - tri->tile_y0 + 1);
+            software_render_stats.clipped_triangles++;
+        }
+    }
+    tile_triangles = (uint32_t*)frame_pool_alloc(FRAME_POOL_TILE_LISTS, entries * sizeof(uint32_t));
+
+    static uint32_t tile_fill[NUM_TILES];
+    for (int t = 0; t < NUM_TILES; t++) {
+        tile_offsets[t + 1] += tile_offsets[t];
+        tile_fill[t] = tile_offsets[t];
+    }
+
+
+    for (unsigned int i = 0; i < triangle_count; i++) {
+        const struct binned_triangle* tri = &triangles[i];
+        for (int ty = tri->tile_y0; ty <= tri->tile_y1; ty++)
+            for (int tx = tri->tile_x0; tx <= tri->tile_x1; tx++)
+                tile_triangles[tile_fill[ty * TILES_X + tx]++] = i;
+    }
+}
+
+// Rasterizes the part of a triangle inside the tile starting at (tile_x, tile_y)
+static void raster_triangle(const struct binned_triangle* tri, int tile_x, int tile_y, uint16_t* depth_tile) {
+    const Projected *a = &tri->v[0], *b = &tri->v[1], *c = &tri->v[2];
+    float inv_area = tri->inv_area;
+
+    // Bounding box clamped to the tile, which is itself clamped to the screen
+    int tile_max_x = tile_x + TILE_SIZE - 1 < H_RESOLUTION - 1 ? tile_x + TILE_SIZE - 1 : H_RESOLUTION - 1;
+    int tile_max_y = tile_y + TILE_SIZE - 1 < V_RESOLUTION - 1 ? tile_y + TILE_SIZE - 1 : V_RESOLUTION - 1;
+    float min_xf = my_fminf(a->x, my_fminf(b->x, c->x));
+    float max_xf = my_fmaxf(a->x, my_fmaxf(b->x, c->x));
+    float min_yf = my_fminf(a->y, my_fminf(b->y, c->y));
+    float max_yf = my_fmaxf(a->y, my_fmaxf(b->y, c->y));
+    int min_x = min_xf < tile_x ? tile_x : (int)min_xf;
+    int min_y = min_yf < tile_y ? tile_y : (int)min_yf;
+    int max_x = max_xf >= tile_max_x ? tile_max_x : (int)max_xf;
+    int max_y = max_yf >= tile_max_y ? tile_max_y : (int)max_yf;
+    if (min_x > max_x || min_y > max_y) return;
+
+    // Normalized barycentric weights (and so 1/z) are affine in screen space, so step them per pixel
+    float dw0_dx = (b->y - c->y) * inv_area, dw0_dy = (c->x - b->x) * inv_area;
+    float dw1_dx = (c->y - a->y) * inv_area, dw1_dy = (a->x - c->x) * inv_area;
+    float dw2_dx = (a->y - b->y) * inv_area, dw2_dy = (b->x - a->x) * inv_area;
+
+    float px = min_x + 0.5f, py = min_y + 0.5f;
+    float w0_row = edge_function(b, c, px, py) * inv_area;
+    float w1_row = edge_function(c, a, px, py) * inv_area;
+    float w2_row = edge_function(a, b, px, py) * inv_area;
+
+    for (int y = min_y; y <= max_y; y++) {
+        float w0 = w0_row, w1 = w1_row, w2 = w2_row;
+        uint16_t* depth = depth_tile + (y - tile_y) * TILE_SIZE + (min_x - tile_x);
+        for (int x = min_x; x <= max_x; x++, depth++) {
+            if (w0 >= 0 && w1 >= 0 && w2 >= 0) {
+                float inv_z = w0 * a->inv_z + w1 * b->inv_z + w2 * c->inv_z;
+                float z = (float)(1 << DEPTH_FRACT_BITS) / inv_z;
+                uint16_t d = z >= DEPTH_CLEAR ? DEPTH_CLEAR - 1 : (uint16_t)z;
+                if (d < *depth) {
+                    *depth = d;
+                    plot_pixel(x, y, tri->color);
+                }
+            }
+            w0 += dw0_dx;
+            w1 += dw1_dx;
+            w2 += dw2_dx;
+        }
+        w0_row += dw0_dy;
+        w1_row += dw1_dy;
+        w2_row += dw2_dy;
+    }
+}
+
+// Worker job: clears and draws whole tiles until none are left. Tiles don't overlap,
+// so workers never touch the same pixels and the pixel buffer needs no locking
+static void raster_tiles(int worker) {
+    uint16_t* depth_tile = depth_tiles + worker * TILE_SIZE * TILE_SIZE;
+    int tile;
+    while ((tile = claim_work_item(worker)) >= 0) {
+        int tile_x = (tile % TILES_X) * TILE_SIZE;
+        int tile_y = (tile / TILES_X) * TILE_SIZE;
+        int width = H_RESOLUTION - tile_x < TILE_SIZE ? H_RESOLUTION - tile_x : TILE_SIZE;
+        int height = V_RESOLUTION - tile_y < TILE_SIZE ? V_RESOLUTION - tile_y : TILE_SIZE;
+
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++) {
+                depth_tile[y * TILE_SIZE + x] = DEPTH_CLEAR;
+                plot_pixel(tile_x + x, tile_y + y, 0x0);
+            }
+
+        for (uint32_t i = tile_offsets[tile]; i < tile_offsets[tile + 1]; i++)
+            raster_triangle(&triangles[tile_triangles[i]], tile_x, tile_y, depth_tile);
+    }
+}
+
+// Darkens a palette color by how directly the face is seen (dot of view direction and normal, in [-1, 0))
+static uint16_t shade_color(uint8_t palette, float dot) {
+    uint16_t blue = (palette_data[palette] & 0b11111) * (-dot);
+    uint16_t green = ((palette_data[palette] & 0b11111100000) >> 5) * (-dot);
+    uint16_t red = ((palette_data[palette] & 0b1111100000000000) >> 11) * (-dot);
+    return blue | (green << 5) | (red << 11);
+}
+
+// Bins a camera-space quad (vertices in winding order) as triangles
+static void bin_quad(const struct Vector quad[4], uint16_t color) {
+    // Sutherland-Hodgman against the near plane, so faces around the camera are cut instead of dropped
+    struct Vector clipped[MAX_CLIPPED_VERTICES];
+    int count = 0;
+    for (int i = 0; i < 4; i++) {
+        const struct Vector* cur = &quad[i];
+        const struct Vector* next = &quad[(i + 1) & 3];
+        int cur_in = cur->z >= NEAR_PLANE;
+        int next_in = next->z >= NEAR_PLANE;
+        if (cur_in)
+            clipped[count++] = *cur;
+        if (cur_in != next_in) {
+            float s = (NEAR_PLANE - cur->z) / (next->z - cur->z);
+            clipped[count++] = add_vector(*cur, multiply_vector(sub_vector(*next, *cur), s));
+        }
+    }
+    if (count < 3) return;
+
+    Projected projected[MAX_CLIPPED_VERTICES];
+    for (int i = 0; i < count; i++)
+        projected[i] = project_vertex(&clipped[i]);
+
+    for (int i = 1; i + 1 < count; i++)
+        bin_triangle(&projected[0], &projected[i], &projected[i + 1], color);
+}
+
+// Rays through pixel centers are interpolated from the rays through three screen corners
+static struct Vector ray_top_left, ray_horizontal, ray_vertical;
+
+static void begin_raymarch() {
+    update_occupancy();
+
+    struct Vector top_right, bottom_left;
+    viewing_ray(0, 0, &ray_top_left);
+    viewing_ray(H_RESOLUTION - 1, 0, &top_right);
+    viewing_ray(0, V_RESOLUTION - 1, &bottom_left);
+    ray_horizontal = divide_vector(sub_vector(top_right, ray_top_left), H_RESOLUTION - 1);
+    ray_vertical = divide_vector(sub_vector(bottom_left, ray_top_left), V_RESOLUTION - 1);
+    ray_top_left = add_vector(ray_top_left, multiply_vector(add_vector(ray_horizontal, ray_vertical), 0.5f));
+}
+
+// Worker job: marches one ray per pixel of every tile it claims
+static void raymarch_tiles(int worker) {
+    int tile;
+    while ((tile = claim_work_item(worker)) >= 0) {
+        int tile_x = (tile % TILES_X) * TILE_SIZE;
+        int tile_y = (tile / TILES_X) * TILE_SIZE;
+        int end_x = tile_x + TILE_SIZE < H_RESOLUTION ? tile_x + TILE_SIZE : H_RESOLUTION;
+        int end_y = tile_y + TILE_SIZE < V_RESOLUTION ? tile_y + TILE_SIZE : V_RESOLUTION;
+
+        for (int y = tile_y; y < end_y; y++) {
+            struct Vector row = add_vector(ray_top_left, multiply_vector(ray_vertical, y));
+            for (int x = tile_x; x < end_x; x++) {
+                struct Vector dir = add_vector(row, multiply_vector(ray_horizontal, x));
+                struct occupancy_hit hit;
+                if (!occupancy_raycast(&camera.pos, &dir, &hit)) {
+                    plot_pixel(x, y, 0x0);
+                    continue;
+                }
+                normalize(&dir);
+                const struct Vector* n = &normal[hit.face];
+                plot_pixel(x, y, shade_color(hit.palette, dir.x*n->x + dir.y*n->y + dir.z*n->z));
+            }
+        }
+    }
+}
+
 void render_software() {
+    // Journaled edits are applied between frames, never while the voxels are being walked
+    apply_voxel_edits();
+
     // Update software camera before render
     update_camera();
 
@@ -276,33 +489,11 @@ void render_software() {
     int y_factor = 0x1 << res_offset;
 
     // Ray-marching based implementation
-    /*
-    for(int x = 0; x < H_RESOLUTION; x++) {
-        for(int y = 0; y < V_RESOLUTION; y++) {
-            struct Ray camera_ray;
-            viewing_ray(x, y, &camera_ray);
-
-            struct Vector add_vec = divide_vector(camera_ray.direction, my_fmaxf(max_vec(camera_ray.direction), fabsf(min_vec(camera_ray.direction))));
-
-            struct Vector curr_pos = add_vector(camera_ray.origin, camera_ray.direction);
-            uint8_t palette = 0;
-            int step = 0;
-            while(max_vec(curr_pos) < SIDE_LEN && min_vec(curr_pos) >= 0 && palette == 0 && step++ < 5) {
-                int xi = (int)(curr_pos.x), yi = (int)(curr_pos.y+0.5f), zi = (int)(curr_pos.z);
-                curr_pos = add_vector(curr_pos, add_vec);
-                palette = *((uint8_t*)GRID_START + xi + zi*SIDE_LEN + yi*SIDE_LEN*SIDE_LEN);
-            }
-
-            if(palette > 0) {
-                *(uint16_t*)((uint32_t)(pixel_buffer_software) + (y << 10) + (x << 1)) = palette_data[palette];
-            } else {
-                *(uint16_t*)((uint32_t)(pixel_buffer_software) + (y << 10) + (x << 1)) = 0x0;
-
-            }
-
-        }
+    if (render_mode == SOFTWARE_RENDER_RAYMARCH) {
+        begin_raymarch();
+        run_render_workers(raymarch_tiles, NUM_TILES);
+        return;
     }
-    */
 
     // Ray-casting based implementation
     /*
@@ -376,167 +567,53 @@ void render_software() {
 
     /*
     Rasterization method:
-    - Project the 8 corners of the cube into the clip plane
-    - Take the min and max of the screen's X and Y
-    - Iterate through a pixels between min and max of X and Y
-    - Check if pixel is inside the projected faces (Simply brute force and consider all 6 faces. Can optimize based on normal of face and camera look vector)
-    - If in pixel, color.
+    - Merge the exposed voxel faces into large coplanar quads (cached until the voxel space changes)
+    - For every quad turned towards the camera, transform its corners into camera space
+    - Clip it against the near plane, project it and split it into a triangle fan
+    - Bin every triangle into the screen tiles its bounding box covers
+    - Workers then take whole tiles, rasterizing their triangles while interpolating 1/z
+    - Color a pixel only if it is closer than what the worker's depth tile already holds
     */
-    const float frac_x_const = focal_length / clip_plane_x;
-    const float frac_y_const = focal_length / clip_plane_y;
-
-    const float V_RESOLUTION_HALF = (V_RESOLUTION >> 1);
-    const float H_RESOLUTION_HALF = (H_RESOLUTION >> 1);
+    software_render_stats.quads = update_greedy_mesh();
+    software_render_stats.quads_drawn = 0;
+    software_render_stats.clipped_triangles = 0;
+    begin_frame_software(MAX_QUAD_TRIANGLES * mesh_quad_count);
 
-    for(unsigned int v = 0; v < voxel_count; v++)
+    for(unsigned int q = 0; q < mesh_quad_count; q++)
     {
-        uint8_t x = voxel_space[v].x;
-        uint8_t y = voxel_space[v].y;
-        uint8_t z = voxel_space[v].z;
-
-        uint8_t palette = voxel_space[v].voxel_id;
-        if (palette == 0 ) continue;
+        const struct mesh_quad* quad = &mesh_quads[q];
+        const struct Vector* n = &normal[quad->face];
+
+        // Every point of the quad lies on its plane, so its center tells which side the camera is on
+        struct Vector diff = sub_vector(
+            quad_corner(quad, (quad->u0 + quad->u1) * 0.5f, (quad->v0 + quad->v1) * 0.5f),
+            camera.pos
+        );
+        if (diff.x*n->x + diff.y*n->y + diff.z*n->z >= 0)
+            continue;
 
-        // Rough instruction count: 403917 per voxel
         debug_start();
 
-        struct Vector corners[8];
-        corners[0] = (struct Vector){x,     y,     z+1};     // top-left-front
-        corners[1] = (struct Vector){x+1,   y,     z+1};     // top-right-front
-        corners[2] = (struct Vector){x,     y+1,   z+1};     // bottom-left-front
-        corners[3] = (struct Vector){x+1,   y+1,   z+1};     // bottom-right-front
-        corners[4] = (struct Vector){x,     y,     z};   // top-left-back
-        corners[5] = (struct Vector){x+1,   y,     z};   // top-right-back
-        corners[6] = (struct Vector){x,     y+1,   z};   // bottom-left-back
-        corners[7] = (struct Vector){x+1,   y+1,   z};   // bottom-right-back
-
-        // Somehow optimize by projecting only one vertex, as a voxel's size is known
-        float screen_x[8], screen_y[8];
-        for (int i = 0; i < 8; i++) {
-            struct Vector diff;
-            diff.x = corners[i].x - camera.pos.x;
-            diff.y = corners[i].y - camera.pos.y;
-            diff.z = corners[i].z - camera.pos.z;
-
-            float cam_z = diff.x * camera.look.x + diff.y * camera.look.y + diff.z * camera.look.z;
-            float cam_x = diff.x * camera.right.x + diff.y * camera.right.y + diff.z * camera.right.z;
-            float cam_y = diff.x * camera.up.x + diff.y * camera.up.y + diff.z * camera.up.z;
-
-            float cam_z_inv = 1 / cam_z;
-            float x_frac = (cam_x * frac_x_const) * cam_z_inv;
-            float y_frac = -(cam_y * frac_y_const) * cam_z_inv;
-
-            screen_x[i] = (x_frac + 1.0f) * H_RESOLUTION_HALF;
-            screen_y[i] = (y_frac + 1.0f) * V_RESOLUTION_HALF;
-        }
-
-        uint8_t face_enable = 0;
-        uint16_t face_palette[6] = {0};
-
-        for(int i = 0; i < 6; i++) {
-            struct Vector diff = {x - camera.pos.x, y - camera.pos.y, z - camera.pos.z};
-
-            diff.x += normal[i].x == 1;
-            diff.y += normal[i].y == 1;
-            diff.z += normal[i].z == 1;
+        normalize(&diff);
+        float dot = diff.x*n->x + diff.y*n->y + diff.z*n->z;
 
-            normalize(&diff);
+        struct Vector view[4] = {
+            to_camera_space(quad_corner(quad, quad->u0, quad->v0)),
+            to_camera_space(quad_corner(quad, quad->u1, quad->v0)),
+            to_camera_space(quad_corner(quad, quad->u1, quad->v1)),
+            to_camera_space(quad_corner(quad, quad->u0, quad->v1))
+        };
+        bin_quad(view, shade_color(quad->palette, dot));
+        software_render_stats.quads_drawn++;
 
-            float dot = diff.x*normal[i].x + diff.y*normal[i].y + diff.z*normal[i].z;
-            face_enable |= (dot < 0) << i;
-
-            if((face_enable >> i) & 0b1) {
-                uint16_t blue = (palette_data[palette] & 0b11111) * (-dot);
-                uint16_t green = ((palette_data[palette] & 0b11111100000) >> 5) * (-dot);
-                uint16_t red = ((palette_data[palette] & 0b1111100000000000) >> 11) * (-dot);
-                face_palette[i] = blue | (green << 5) | (red << 11);
-            }
-
-        }
-
-        // Currently able to draw outside the resolution screen, need to fix
-        for(int i = 0; i < 6; i++) {
-            if(!((face_enable >> i) & 0b1))
-                continue;
-
-            int i0 = faces[i][0], i1 = faces[i][1], i2 = faces[i][2], i3 = faces[i][3];
-
-            int x0 = (int)screen_x[i0], y0 = (int)screen_y[i0];
-            int x1 = (int)screen_x[i1], y1 = (int)screen_y[i1];
-            int x2 = (int)screen_x[i2], y2 = (int)screen_y[i2];
-            int x3 = (int)screen_x[i3], y3 = (int)screen_y[i3];
-            uint16_t color = face_palette[i];
-
-            draw_line(x0, y0, x1, y1, color);
-            draw_line(x1, y1, x2, y2, color);
-            draw_line(x2, y2, x3, y3, color);
-            draw_line(x3, y3, x0, y0, color);
-
-            int cx = (x0 + x1 + x2 + x3) >> 2;
-            int cy = (y0 + y1 + y2 + y3) >> 2;
-
-            // If centroid is off-screen, scan bounding box for a valid pixel inside the quad
-            // Rough Instruction count: 938
-            if(cx >= H_RESOLUTION || cy >= V_RESOLUTION || cx < 0 || cy < 0) {
-                int min_x = x0, max_x = x0;
-                int min_y = y0, max_y = y0;
-                min_x = (x1 < min_x) ? x1 : min_x;
-                min_x = (x2 < min_x) ? x2 : min_x;
-                min_x = (x3 < min_x) ? x3 : min_x;
-                max_x = (x1 > max_x) ? x1 : max_x;
-                max_x = (x2 > max_x) ? x2 : max_x;
-                max_x = (x3 > max_x) ? x3 : max_x;
-                min_y = (y1 < min_y) ? y1 : min_y;
-                min_y = (y2 < min_y) ? y2 : min_y;
-                min_y = (y3 < min_y) ? y3 : min_y;
-                max_y = (y1 > max_y) ? y1 : max_y;
-                max_y = (y2 > max_y) ? y2 : max_y;
-                max_y = (y3 > max_y) ? y3 : max_y;
-
-                // Clamp to screen bounds
-                if(min_x < 0) min_x = 0;
-                if(max_x >= H_RESOLUTION) max_x = H_RESOLUTION - 1;
-                if(min_y < 0) min_y = 0;
-                if(max_y >= V_RESOLUTION) max_y = V_RESOLUTION - 1;
-
-                // Point-in-quad test using cross product sign
-                int found = 0;
-                int quad_x[4] = {x0, x1, x2, x3};
-                int quad_y[4] = {y0, y1, y2, y3};
-                for(int sx = min_x; sx <= max_x && !found; sx++) {
-                    for(int sy = min_y; sy <= max_y && !found; sy++) {
-                        int sign = 0;
-                        for(int q = 0; q < 4; q++) {
-                            int dx1 = quad_x[(q+1)%4] - quad_x[q];
-                            int dy1 = quad_y[(q+1)%4] - quad_y[q];
-                            int dx2 = sx - quad_x[q];
-                            int dy2 = sy - quad_y[q];
-                            int cross = dx1 * dy2 - dy1 * dx2;
-
-                            if(cross == 0) { sign = 0; break; }
-                            if(get_pixel(sx, sy) != 0) { sign = 0; break; }
-                            if(sign == 0) sign = (cross > 0) ? 1 : -1;
-                            else if((cross > 0 && sign < 0) || (cross < 0 && sign > 0)) {
-                                sign = 0;
-                                break;
-                            }
-                        }
-                        if(sign != 0) {
-                            cx = sx;
-                            cy = sy;
-                            found = 1;
-                        }
-                    }
-                }
-
-            }
-
-            flood_fill(cx, cy, color);
-
-        }
         debug_end();
     }
 
+    build_tile_bins();
+    software_render_stats.triangles = triangle_count;
+    software_render_stats.binned_triangles = tile_offsets[NUM_TILES];
+    run_render_workers(raster_tiles, NUM_TILES);
+
     // for(uint8_t x = 0; x < SIDE_LEN; x++) {
     //     for(uint8_t z = 0; z < SIDE_LEN; z++) {
     //         for(uint8_t y = 0; y < SIDE_LEN; y++) {
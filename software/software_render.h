@@ -12,6 +12,24 @@ struct Ray_fixed {
     struct Vector_16fixed origin, direction;
 };
 
+struct software_render_stats {
+    unsigned int quads;            // merged quads in the cached mesh
+    unsigned int quads_drawn;      // quads facing the camera in the last frame
+    unsigned int triangles;        // triangles binned in the last frame
+    unsigned int binned_triangles; // triangles summed over the tiles they were binned into
+    unsigned int clipped_triangles; // triangles left out of the last frame for lack of memory to bin them
+};
+
+extern struct software_render_stats software_render_stats;
+
+enum software_render_mode {
+    SOFTWARE_RENDER_RASTER,   // greedy-meshed quads through the tile rasterizer
+    SOFTWARE_RENDER_RAYMARCH, // one DDA ray per pixel through the occupancy grid
+};
+
+/** @brief Selects how render_software draws the voxel space */
+void set_render_mode_software(enum software_render_mode mode);
+
 void setup_pixel_buffer_software();
 
 void set_camera_software(struct Camera* cam);
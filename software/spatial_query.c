@@ -0,0 +1,141 @@
+#include <math.h>
+#include "software/spatial_query.h"
+#include "software/occupancy.h"
+
+/* Steps voxel by voxel from origin, looking each one up in the voxel space, until
+   the ray passes max_t. Used while the grid is stale, so a pick never waits on a rebuild */
+static int walk_voxel_space(const struct Vector* origin, const struct Vector* dir, float max_t, struct occupancy_hit* hit) {
+    float start[3] = {origin->x, origin->y, origin->z};
+    float step_dir[3] = {dir->x, dir->y, dir->z};
+    int cell[3], step[3];
+    float t_max[3], t_delta[3];
+    for (int a = 0; a < 3; ++a) {
+        cell[a] = floor_to_int(start[a]);
+        if (step_dir[a] == 0) {
+            step[a] = 0;
+            t_max[a] = NO_CROSSING;
+            t_delta[a] = NO_CROSSING;
+        } else {
+            float inv_dir = 1 / step_dir[a];
+            step[a] = step_dir[a] > 0 ? 1 : -1;
+            t_max[a] = (cell[a] + (step[a] > 0) - start[a]) * inv_dir;
+            t_delta[a] = fabsf(inv_dir);
+        }
+    }
+
+    while (1) {
+        int axis = min_axis(t_max);
+        float t = t_max[axis];
+        if (t > max_t) return 0;
+        cell[axis] += step[axis];
+        t_max[axis] += t_delta[axis];
+
+        v_pos pos = {cell[0], cell[1], cell[2]};
+        uint8_t palette = get_voxel(pos);
+        if (palette) {
+            *hit = (struct occupancy_hit){
+                .t = t, .pos = pos, .palette = palette, .face = entry_face(axis, step[axis]),
+            };
+            return 1;
+        }
+    }
+}
+
+int pick_voxel(const struct Vector* origin, const struct Vector* dir, float max_t, struct voxel_pick* pick) {
+    struct occupancy_hit hit;
+    /* Rebuilding the grid visits every voxel, so only do it when walking the ray
+       through the voxel space could take more lookups than that */
+    float steps = (fabsf(dir->x) + fabsf(dir->y) + fabsf(dir->z)) * max_t;
+    if (!occupancy_current() && steps < voxel_count) {
+        if (!walk_voxel_space(origin, dir, max_t, &hit)) return 0;
+    } else {
+        update_occupancy();
+        if (!occupancy_raycast(origin, dir, &hit) || hit.t > max_t) return 0;
+    }
+
+    v_pos normal = face_offset[hit.face];
+    *pick = (struct voxel_pick){
+        .t = hit.t,
+        .voxel = hit.pos,
+        .empty = {hit.pos.x + normal.x, hit.pos.y + normal.y, hit.pos.z + normal.z},
+        .normal = normal,
+        .palette = hit.palette,
+        .face = hit.face,
+    };
+    return 1;
+}
+
+static inline int clamp(int value, int lo, int hi) {
+    return value < lo ? lo : value > hi ? hi : value;
+}
+
+// Looks up every cell of the box in the voxel space, for boxes smaller than a grid rebuild
+static unsigned int scan_voxel_space(v_pos min, v_pos max, int stop_at_first) {
+    unsigned int count = 0;
+    for (int z = min.z; z <= max.z; ++z)
+        for (int y = min.y; y <= max.y; ++y)
+            for (int x = min.x; x <= max.x; ++x) {
+                if (get_voxel((v_pos){x, y, z}) == 0) continue;
+                if (stop_at_first) return 1;
+                ++count;
+            }
+    return count;
+}
+
+/* Walks the occupied bricks the box overlaps, masking each brick row down to the box.
+   Stops at the first voxel if stop_at_first is set */
+static unsigned int scan_box(v_pos min, v_pos max, int stop_at_first) {
+    if (min.x > max.x || min.y > max.y || min.z > max.z) return 0;
+    float volume = (float)(max.x - min.x + 1) * (max.y - min.y + 1) * (max.z - min.z + 1);
+    if (!occupancy_current() && volume < voxel_count)
+        return scan_voxel_space(min, max, stop_at_first);
+
+    update_occupancy();
+    if (occupancy.brick_count == 0) return 0;
+
+    int bricks[3] = {occupancy.bricks_x, occupancy.bricks_y, occupancy.bricks_z};
+    int lo[3] = {min.x - occupancy.origin_x, min.y - occupancy.origin_y, min.z - occupancy.origin_z};
+    int hi[3] = {max.x - occupancy.origin_x, max.y - occupancy.origin_y, max.z - occupancy.origin_z};
+    for (int a = 0; a < 3; ++a) {
+        if (lo[a] > hi[a] || hi[a] < 0 || lo[a] >= bricks[a] << BRICK_SHIFT) return 0;
+        lo[a] = clamp(lo[a], 0, (bricks[a] << BRICK_SHIFT) - 1);
+        hi[a] = clamp(hi[a], 0, (bricks[a] << BRICK_SHIFT) - 1);
+    }
+
+    unsigned int count = 0;
+    for (int bz = lo[2] >> BRICK_SHIFT; bz <= hi[2] >> BRICK_SHIFT; ++bz)
+        for (int by = lo[1] >> BRICK_SHIFT; by <= hi[1] >> BRICK_SHIFT; ++by)
+            for (int bx = lo[0] >> BRICK_SHIFT; bx <= hi[0] >> BRICK_SHIFT; ++bx) {
+                int index = (bz * bricks[1] + by) * bricks[0] + bx;
+                if (!((occupancy.summary[index >> 3] >> (index & 7)) & 0b1)) continue;
+                const struct occupancy_brick* brick = &occupancy.bricks[occupancy.directory[index]];
+
+                // cells of the box within this brick
+                int x0 = clamp(lo[0] - (bx << BRICK_SHIFT), 0, BRICK_SIZE - 1);
+                int x1 = clamp(hi[0] - (bx << BRICK_SHIFT), 0, BRICK_SIZE - 1);
+                int y0 = clamp(lo[1] - (by << BRICK_SHIFT), 0, BRICK_SIZE - 1);
+                int y1 = clamp(hi[1] - (by << BRICK_SHIFT), 0, BRICK_SIZE - 1);
+                int z0 = clamp(lo[2] - (bz << BRICK_SHIFT), 0, BRICK_SIZE - 1);
+                int z1 = clamp(hi[2] - (bz << BRICK_SHIFT), 0, BRICK_SIZE - 1);
+                uint64_t columns = (0xFFu >> (BRICK_SIZE - 1 - x1)) & (0xFFu << x0);
+                uint64_t mask = 0;
+                for (int y = y0; y <= y1; ++y)
+                    mask |= columns << (y << BRICK_SHIFT);
+
+                for (int z = z0; z <= z1; ++z) {
+                    uint64_t bits = brick->occupied[z] & mask;
+                    if (bits == 0) continue;
+                    if (stop_at_first) return 1;
+                    count += __builtin_popcountll(bits);
+                }
+            }
+    return count;
+}
+
+int box_overlaps_voxels(v_pos min, v_pos max) {
+    return scan_box(min, max, 1) != 0;
+}
+
+unsigned int count_voxels_in_box(v_pos min, v_pos max) {
+    return scan_box(min, max, 0);
+}
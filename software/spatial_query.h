@@ -0,0 +1,42 @@
+#ifndef SPATIAL_QUERY_H
+#define SPATIAL_QUERY_H
+
+#include <stdint.h>
+#include "firmware/firmware.h"
+#include "software/vector_math.h"
+
+/* Queries run on the occupancy grid, in voxel space coordinates. Journaled edits
+   are patched into the grid first; if it needs a full rebuild instead (after a load
+   or a direct set_voxel), queries cheaper than that rebuild look the voxels up in
+   the voxel space. Either way they see every edit applied so far, but not edits
+   still waiting in the journal */
+
+/** @brief First voxel along a ray, and where a voxel placed against it would go */
+struct voxel_pick {
+    float t;         // distance along the ray, in units of its direction
+    v_pos voxel;     // voxel that was hit
+    v_pos empty;     // empty cell in front of the face that was hit
+    v_pos normal;    // outward normal of that face, pointing back along the ray
+    uint8_t palette;
+    uint8_t face;    // enum voxel_face the ray entered through
+};
+
+/** @brief Finds the first voxel a ray hits within max_t, with a two-level DDA
+ *  over the grid, or one voxel at a time while the grid is stale
+ *  @param origin start of the ray
+ *  @param dir direction of the ray, which need not be normalized
+ *  @param max_t furthest distance along the ray to look, in units of dir
+ *  @param pick filled in with the voxel that was hit
+ *  @return 1 if a voxel was hit within max_t, 0 otherwise
+ */
+int pick_voxel(const struct Vector* origin, const struct Vector* dir, float max_t, struct voxel_pick* pick);
+
+/** @brief Whether any voxel lies in the box from min to max, both corners included */
+int box_overlaps_voxels(v_pos min, v_pos max);
+
+/** @brief Counts the voxels in the box from min to max, both corners included,
+ *  skipping empty bricks whole and counting each brick row with one popcount
+ */
+unsigned int count_voxels_in_box(v_pos min, v_pos max);
+
+#endif